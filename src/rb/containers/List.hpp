@@ -1,11 +1,17 @@
 #pragma once
 
 #include <initializer_list>
+#include <iterator>
 
 #include <rb/core/assert.hpp>
+#include <rb/core/exchange.hpp>
 #include <rb/core/iter/IteratorTraits.hpp>
+#include <rb/core/memory/Allocator.hpp>
+#include <rb/core/memory/AllocatorTraits.hpp>
 #include <rb/core/memory/construct.hpp>
 #include <rb/core/memory/destroy.hpp>
+#include <rb/core/memory/EmptyBase.hpp>
+#include <rb/core/memory/toAddress.hpp>
 #include <rb/core/swap.hpp>
 #include <rb/ranges/IteratorRange.hpp>
 
@@ -23,10 +29,27 @@ namespace impl::list {
 		}
 	};
 
+	template <class T>
+	struct ValueNode : Node {
+		T value;
+	};
+
 } // namespace impl::list
 
-template <class T>
-class List final {
+/**
+ * List is a doubly-linked list.
+ *
+ * @tparam T The type of the elements.
+ * @tparam Alloc An allocator that is used to acquire/release memory for nodes (it is rebound to the node type);
+ * stateless allocators take no space.
+ */
+template <class T, class Alloc = core::Allocator<T>>
+class List final : core::EmptyBase<typename core::AllocatorTraits<Alloc>::template RebindAlloc<impl::list::ValueNode<T>>> {
+	using Node = impl::list::ValueNode<T>;
+	using NodeAlloc = typename core::AllocatorTraits<Alloc>::template RebindAlloc<Node>;
+	using NodeTraits = core::AllocatorTraits<NodeAlloc>;
+	using Super = core::EmptyBase<NodeAlloc>;
+
 public:
 	class ConstIterator final {
 		friend class List;
@@ -151,11 +174,14 @@ public:
 		}
 	};
 
+	using Allocator = Alloc;
+
 	using ConstRange = ranges::IteratorRange<ConstIterator>;
 	using Range = ranges::IteratorRange<Iterator>;
 
 	// NOLINTBEGIN(*-identifier-naming)
 	using value_type = T;
+	using allocator_type = Alloc;
 	using size_type = usize;
 	using difference_type = isize;
 	using reference = T&;
@@ -165,13 +191,19 @@ public:
 	// NOLINTEND(*-identifier-naming)
 
 	// ctor.1
-	/// Default constructor.
-	/// ~~Constructs an empty container with a default-constructed allocator.~~
-	constexpr List() noexcept = default;
+	/// Default constructor. Constructs an empty container with a default-constructed allocator.
+	constexpr List() noexcept(core::isNothrowDefaultConstructible<NodeAlloc>) = default;
+
+	// ctor.2
+	/// Constructs an empty container with the given allocator @p a.
+	constexpr explicit List(Alloc const& a) noexcept
+	    : Super(NodeAlloc(a)) {
+	}
 
 	// ctor.3
 	/// Constructs the container with @p count copies of @p value.
-	List(usize count, T const& value) noexcept(core::isNothrowCopyConstructible<T>) {
+	List(usize count, T const& value, Alloc const& a = Alloc())
+	    : Super(NodeAlloc(a)) {
 		for (; count; --count) {
 			pushBack(value);
 		}
@@ -179,7 +211,8 @@ public:
 
 	// ctor.4
 	/// Constructs the container with @p count default-inserted instances of @p T. No copies are made.
-	explicit List(usize count) noexcept(core::isNothrowDefaultConstructible<T>) {
+	explicit List(usize count, Alloc const& a = Alloc())
+	    : Super(NodeAlloc(a)) {
 		for (; count; --count) {
 			emplaceBack();
 		}
@@ -189,7 +222,8 @@ public:
 	/// Constructs the container with the contents of the range [@p first, @p last).
 	template <class InputIt,
 	    RB_REQUIRES_T(core::IsInputIterator<InputIt>)>
-	List(InputIt first, InputIt last) {
+	List(InputIt first, InputIt last, Alloc const& a = Alloc())
+	    : Super(NodeAlloc(a)) {
 		for (; first != last; ++first) {
 			pushBack(*first);
 		}
@@ -198,32 +232,33 @@ public:
 	// ctor.6
 	/// Copy constructor. Constructs the container with the copy of @p rhs.
 	List(List const& rhs)
-	    : List{rhs.begin(), rhs.end()} {
+	    : List(rhs.begin(), rhs.end(), rhs.allocator()) {
 	}
 
 	// ctor.8
 	/// Move constructor. Constructs the container with the contents of @p rhs using move semantics.
-	/// ~~Allocator is obtained by move-construction from the allocator belonging to @p rhs.~~
-	constexpr List(List&& rhs) noexcept {
-		if (rhs.empty()) {
-			init();
-		} else {
-			sentinel_.next = rhs.sentinel_.next;
-			sentinel_.prev = rhs.sentinel_.prev;
-		}
+	/// Allocator is obtained by move-construction from the allocator belonging to @p rhs.
+	constexpr List(List&& rhs) noexcept
+	    : Super(RB_MOVE(rhs.alloc()))
+	    , size_(rhs.size_) {
+		sentinel_.next = rhs.sentinel_.next;
+		sentinel_.prev = rhs.sentinel_.prev;
+		relink();
 		rhs.init();
+		rhs.size_ = 0;
 	}
 
 	// ctor.10
 	/// Constructs the container with the contents of the initializer list @p il.
-	List(std::initializer_list<T> il)
-	    : List{il.begin(), il.end()} {
+	List(std::initializer_list<T> il, Alloc const& a = Alloc())
+	    : List(il.begin(), il.end(), a) {
 	}
 
 	/// Constructs the container with the contents of the range @p r.
 	template <class R,
 	    RB_REQUIRES_T(ranges::IsInputRangeNonStrict<R>)>
-	List(ranges::FromRange /*fromRange*/, R&& range) {
+	List(ranges::FromRange /*fromRange*/, R&& range, Alloc const& a = Alloc())
+	    : Super(NodeAlloc(a)) {
 		for (auto&& r = RB_FWD(range); !ranges::empty(r); ranges::popFront(r)) {
 			pushBack(ranges::front(r));
 		}
@@ -234,10 +269,17 @@ public:
 	}
 
 	/// Copy assignment operator. Replaces the contents with a copy of @p rhs.
+	/// The allocator is kept unless AllocatorTraits::PropagateOnContainerCopyAssignment.
 	List& operator=(List const& rhs) {
 		if (this != &rhs) {
-			this->~List();
-			new (this) List(rhs);
+			if constexpr (NodeTraits::PropagateOnContainerCopyAssignment::value) {
+				if (!NodeTraits::equal(alloc(), rhs.alloc())) {
+					// the nodes must be given back to the allocator which allocated them
+					clear();
+				}
+				alloc() = rhs.alloc();
+			}
+			assign(rhs.begin(), rhs.end());
 		}
 		return *this;
 	}
@@ -245,19 +287,25 @@ public:
 	/// Move assignment operator.
 	/// Replaces the contents with those of @p rhs using move semantics
 	/// (i.e., the data in @p rhs is moved from @p rhs into this container).
+	/// The allocator is kept unless AllocatorTraits::PropagateOnContainerMoveAssignment;
+	/// if the allocators aren't equal then, the elements are moved one by one.
 	/// @p rhs is in a valid but unspecified state afterward.
-	List& operator=(List&& rhs) noexcept {
+	List& operator=(List&& rhs) noexcept(kMovesNodes) {
 		if (this != &rhs) {
-			this->~List();
-			new (this) List(RB_MOVE(rhs));
+			if constexpr (kMovesNodes) {
+				takeNodes(rhs);
+			} else if (alloc() == rhs.alloc()) {
+				takeNodes(rhs);
+			} else {
+				assign(std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+			}
 		}
 		return *this;
 	}
 
 	/// Replaces the contents with those identified by initializer list @p il.
 	List& operator=(std::initializer_list<T> il) {
-		this->~List();
-		new (this) List(il);
+		assign(il.begin(), il.end());
 		return *this;
 	}
 
@@ -305,6 +353,11 @@ public:
 		return size_;
 	}
 
+	/// @return the allocator associated with the container.
+	constexpr Alloc allocator() const noexcept {
+		return Alloc(alloc());
+	}
+
 	constexpr T const& front() const {
 		RB_ASSERT(!empty());
 		return *begin();
@@ -389,7 +442,7 @@ public:
 			return pos;
 		}
 
-		List list(count, value);
+		List list(count, value, allocator());
 		auto it = list.begin();
 		splice(pos, list);
 		return it;
@@ -398,7 +451,7 @@ public:
 	template <class InputIt,
 	    RB_REQUIRES_T(core::IsInputIterator<InputIt>)>
 	Iterator insert(Iterator pos, InputIt first, InputIt last) {
-		List list(first, last);
+		List list(first, last, allocator());
 		if (list.empty()) {
 			return pos;
 		}
@@ -508,25 +561,24 @@ public:
 		if (this == &list || list.empty()) {
 			return;
 		}
+		if constexpr (!NodeTraits::IsAlwaysEqual::value) {
+			RB_ASSERT_MSG("nodes must be released by the same allocator", alloc() == list.alloc());
+		}
 
 		transfer(pos, list.begin(), list.end());
 		size_ += list.size_;
 		list.size_ = 0;
 	}
 
+	/// Exchanges the contents and, if AllocatorTraits::PropagateOnContainerSwap, the allocators with @p rhs.
+	/// @pre the allocators are equal unless they propagate on swap
 	constexpr void swap(List& rhs) noexcept {
-		if (empty() || rhs.empty()) {
-			auto& other = empty() ? *this : rhs;
-			other.sentinel_.next = sentinel_.next;
-			other.sentinel_.prev = sentinel_.prev;
-			other.sentinel_.next->prev = &other.sentinel_;
-			other.sentinel_.prev->next = &other.sentinel_;
-			init();
-		} else {
-			core::swap(sentinel_, rhs.sentinel_);
-			core::swap(sentinel_.prev->next, rhs.sentinel_.prev->next);
-			core::swap(sentinel_.next->prev, rhs.sentinel_.next->prev);
-		}
+		NodeTraits::swapOnContainerSwap(alloc(), rhs.alloc());
+		core::swap(sentinel_.next, rhs.sentinel_.next);
+		core::swap(sentinel_.prev, rhs.sentinel_.prev);
+		core::swap(size_, rhs.size_);
+		relink();
+		rhs.relink();
 	}
 
 	usize unique() {
@@ -558,9 +610,8 @@ public:
 	}
 
 private:
-	struct Node : impl::list::Node {
-		T value;
-	};
+	static constexpr bool kMovesNodes = NodeTraits::PropagateOnContainerMoveAssignment::value
+	                                 || NodeTraits::IsAlwaysEqual::value;
 
 	// Moves the elements from [first, last) before pos.
 	static constexpr void transfer(impl::list::Node* pos, impl::list::Node* first, impl::list::Node* last) noexcept {
@@ -584,31 +635,75 @@ private:
 	}
 
 	template <class... Args>
-	Node* construct(Args&&... args) noexcept(core::isNothrowConstructible<T, Args...>) {
-		auto* node = static_cast<Node*>(operator new(sizeof(Node)));
+	Node* construct(Args&&... args) {
+		Node* const node = core::toAddress(NodeTraits::allocate(alloc(), 1));
 		try {
-			auto* ptr = core::addressOf(node->value);
-			core::construct(ptr, RB_FWD(args)...);
+			NodeTraits::construct(alloc(), core::addressOf(node->value), RB_FWD(args)...);
 		} catch (...) {
-			::operator delete(node);
+			NodeTraits::deallocate(alloc(), node, 1);
 			throw;
 		}
 		return node;
 	}
 
 	void destroy(Node* node) noexcept(core::isNothrowDestructible<T>) {
-		core::destroy(core::addressOf(node->value));
-		::operator delete(node);
+		NodeTraits::destroy(alloc(), core::addressOf(node->value));
+		NodeTraits::deallocate(alloc(), node, 1);
 		--size_;
 	}
 
+	constexpr NodeAlloc const& alloc() const noexcept {
+		return Super::get();
+	}
+
+	constexpr NodeAlloc& alloc() noexcept {
+		return Super::get();
+	}
+
 	constexpr void init() noexcept {
 		sentinel_.next = &sentinel_;
 		sentinel_.prev = &sentinel_;
 	}
 
+	// replaces the contents with the nodes of rhs, which must be deallocatable by the allocator after it has propagated
+	void takeNodes(List& rhs) noexcept(core::isNothrowDestructible<T>) {
+		clear();
+		if constexpr (NodeTraits::PropagateOnContainerMoveAssignment::value) {
+			alloc() = RB_MOVE(rhs.alloc());
+		}
+		sentinel_.next = rhs.sentinel_.next;
+		sentinel_.prev = rhs.sentinel_.prev;
+		size_ = core::exchange(rhs.size_, 0);
+		relink();
+		rhs.init();
+	}
+
+	// replaces the contents with [first, last), assigning to the existing elements before allocating new nodes
+	template <class InputIt>
+	void assign(InputIt first, InputIt last) {
+		auto it = begin();
+		for (; it != end() && first != last; ++it, ++first) {
+			*it = *first;
+		}
+		if (first == last) {
+			erase(it, end());
+		} else {
+			insert(end(), first, last);
+		}
+	}
+
+	// points the outer nodes back to the sentinel after the nodes were taken from another list
+	constexpr void relink() noexcept {
+		if (size_ == 0) {
+			init();
+		} else {
+			sentinel_.next->prev = &sentinel_;
+			sentinel_.prev->next = &sentinel_;
+		}
+	}
+
 	template <class... Args>
-	Node* insertBefore(impl::list::Node* pos, Args&&... args) noexcept(core::isNothrowConstructible<T, Args...>) {
+	Node* insertBefore(impl::list::Node* pos, Args&&... args) {
 		auto* node = construct(RB_FWD(args)...);
 		node->next = pos;
 		node->prev = pos->prev;
@@ -630,8 +725,8 @@ template <class R,
     RB_REQUIRES_T(ranges::IsInputRangeNonStrict<core::RemoveRef<R>>)>
 List(ranges::FromRange, R&& range) -> List<core::RemoveRef<ranges::ValueType<core::RemoveRef<R>>>>;
 
-template <class T>
-constexpr bool operator==(List<T> const& lhs, List<T> const& rhs) {
+template <class T, class Alloc>
+constexpr bool operator==(List<T, Alloc> const& lhs, List<T, Alloc> const& rhs) {
 	if (lhs.size() != rhs.size()) {
 		return false;
 	}
@@ -647,18 +742,18 @@ constexpr bool operator==(List<T> const& lhs, List<T> const& rhs) {
 	return true;
 }
 
-template <class T>
-constexpr bool operator!=(List<T> const& lhs, List<T> const& rhs) {
+template <class T, class Alloc>
+constexpr bool operator!=(List<T, Alloc> const& lhs, List<T, Alloc> const& rhs) {
 	return !(lhs == rhs);
 }
 
-template <class T, class U = T>
-usize erase(List<T>& list, U const& value) {
+template <class T, class Alloc, class U = T>
+usize erase(List<T, Alloc>& list, U const& value) {
 	return list.removeIf([&](auto& x) { return x == value; });
 }
 
-template <class T, class UnaryPredicate>
-usize eraseIf(List<T>& list, UnaryPredicate pred) {
+template <class T, class Alloc, class UnaryPredicate>
+usize eraseIf(List<T, Alloc>& list, UnaryPredicate pred) {
 	return list.removeIf(pred);
 }
 
@@ -6,17 +6,20 @@
 #include <rb/core/exchange.hpp>
 #include <rb/core/memory/Allocator.hpp>
 #include <rb/core/memory/AllocatorTraits.hpp>
+#include <rb/core/memory/CompressedPair.hpp>
 #include <rb/core/memory/uninitialized.hpp>
 #include <rb/core/Span.hpp>
 #include <rb/core/swap.hpp>
+#include <rb/ext/ZeroMemory.hpp>
+#include <rb/ranges/traits.hpp>
 
 namespace rb::containers {
-template <class T>
+template <class T, class Alloc = core::Allocator<T>>
 class Vector;
 } // namespace rb::containers
 
-template <class T>
-struct rb::core::ContainerTraits<rb::containers::Vector<T>> {
+template <class T, class Alloc>
+struct rb::core::ContainerTraits<rb::containers::Vector<T, Alloc>> {
 	using Value = T;
 	using Iterator = T*;
 	using ConstIterator = T const*;
@@ -26,20 +29,30 @@ struct rb::core::ContainerTraits<rb::containers::Vector<T>> {
 
 namespace rb::containers {
 
-template <class T>
-class Vector final : public core::Sliceable<Vector<T>, core::Span<T const>, core::Span<T>> {
+/**
+ * Vector is a sequence container that encapsulates dynamic size arrays.
+ *
+ * @tparam T The type of the elements.
+ * @tparam Alloc An allocator that is used to acquire/release memory;
+ * stateless allocators take no space (see CompressedPair).
+ */
+template <class T, class Alloc>
+class Vector final : public core::Sliceable<Vector<T, Alloc>, core::Span<T const>, core::Span<T>> {
 	using Super = core::Sliceable<Vector, core::Span<T const>, core::Span<T>>;
-	using Alloc = core::Allocator<T>;
 	using AllocTraits = core::AllocatorTraits<Alloc>;
+	static_assert(core::isSame<typename AllocTraits::Value, T>, "Alloc::Value must be the same as T");
 
 public:
 	RB_USE_BASE_CONTAINER_TYPES(Super)
 
+	using Allocator = Alloc;
+
 	using ConstRange = core::Span<T const>;
 	using Range = core::Span<T>;
 
 	// NOLINTBEGIN(*-identifier-naming)
 	using value_type = T;
+	using allocator_type = Alloc;
 	using size_type = usize;
 	using difference_type = isize;
 	using reference = T&;
@@ -55,69 +68,90 @@ public:
 #pragma region constructors
 
 	// ctor.1
-	constexpr Vector() noexcept = default;
+	constexpr Vector() noexcept(core::isNothrowDefaultConstructible<Alloc>)
+	    : storage_{core::kInPlaceIndex<0>, nullptr} {
+	}
+
+	// ctor.2
+	constexpr explicit Vector(Alloc const& a) noexcept
+	    : storage_{core::kInPlaceIndex<1>, a, nullptr} {
+	}
 
 	// ctor.3
-	Vector(usize count, T const& value)
+	Vector(usize count, T const& value, Alloc const& a = Alloc())
 	    : size_{count}
 	    , capacity_{count}
-	    , data_{Alloc{}.allocate(capacity_)} {
-		core::uninitializedFillN(data_, count, value);
+	    , storage_{core::kInPlaceIndex<1>, a, nullptr} {
+		ptr() = AllocTraits::allocate(alloc(), capacity_);
+		core::uninitializedFillN(ptr(), count, value);
 	}
 
 	// ctor.4
-	explicit Vector(usize count)
+	explicit Vector(usize count, Alloc const& a = Alloc())
+	    : size_{count}
+	    , capacity_{count}
+	    , storage_{core::kInPlaceIndex<1>, a, nullptr} {
+		ptr() = AllocTraits::allocate(alloc(), capacity_);
+		core::uninitializedValueConstructN(ptr(), count);
+	}
+
+	/// Constructs the container with @p count zero-initialized elements without constructing them one by one;
+	/// the memory isn't even touched if the allocator knows it is zero-filled (see AllocatorTraits::allocateZeroed()).
+	template <bool _ = true,
+	    RB_REQUIRES(_&& core::isTriviallyDefaultConstructible<T> && core::isTriviallyDestructible<T>)>
+	Vector(usize count, ext::ZeroMemory /*kZeroMemory*/, Alloc const& a = Alloc())
 	    : size_{count}
 	    , capacity_{count}
-	    , data_{Alloc{}.allocate(capacity_)} {
-		core::uninitializedValueConstructN(data_, count);
+	    , storage_{core::kInPlaceIndex<1>, a, nullptr} {
+		ptr() = AllocTraits::allocateZeroed(alloc(), capacity_);
 	}
 
 	// ctor.5
 	template <class InputIt,
 	    RB_REQUIRES_T(core::IsInputIterator<InputIt>)>
-	Vector(InputIt first, InputIt last)
+	Vector(InputIt first, InputIt last, Alloc const& a = Alloc())
 	    : size_{static_cast<usize>(std::distance(first, last))}
 	    , capacity_{size_}
-	    , data_{Alloc{}.allocate(capacity_)} {
-		core::uninitializedCopy(first, last, data_);
+	    , storage_{core::kInPlaceIndex<1>, a, nullptr} {
+		ptr() = AllocTraits::allocate(alloc(), capacity_);
+		core::uninitializedCopy(first, last, ptr());
 	}
 
 	// ctor.6
 	Vector(Vector const& rhs)
-	    : Vector(rhs.begin(), rhs.end()) {
+	    : Vector(rhs.begin(), rhs.end(), rhs.alloc()) {
 	}
 
 	// ctor.8
 	Vector(Vector&& rhs) noexcept
 	    : size_(core::exchange(rhs.size_, 0))
 	    , capacity_(core::exchange(rhs.capacity_, 0))
-	    , data_(core::exchange(rhs.data_, nullptr)) {
+	    , storage_(core::kInPlaceIndex<1>, RB_MOVE(rhs.alloc()), core::exchange(rhs.ptr(), nullptr)) {
 	}
 
 	// ctor.10
 	/// Constructs the container with the contents of the initializer list @p il.
-	Vector(std::initializer_list<T> il)
-	    : Vector(il.begin(), il.end()) {
+	Vector(std::initializer_list<T> il, Alloc const& a = Alloc())
+	    : Vector(il.begin(), il.end(), a) {
 	}
 
 	// ctor.11
 	template <class R,
 	    RB_REQUIRES_T(core::And<ranges::IsInputRangeNonStrict<R>, core::Not<ranges::IsInfinite<R>>>)>
-	Vector(ranges::FromRange /*fromRange*/, R&& range)
+	Vector(ranges::FromRange /*fromRange*/, R&& range, Alloc const& a = Alloc())
 	    : size_{ranges::size(RB_FWD(range))}
 	    , capacity_{size_}
-	    , data_{Alloc{}.allocate(capacity_)} {
+	    , storage_{core::kInPlaceIndex<1>, a, nullptr} {
+		ptr() = AllocTraits::allocate(alloc(), capacity_);
 		for (auto&& r = RB_FWD(range); !ranges::empty(r); ranges::popFront(r)) {
 			// FIXME
 		}
 	}
 
 	~Vector() noexcept(core::isNothrowDestructible<T>) {
-		if (data_) {
+		if (ptr()) {
 			clear();
-			Alloc alloc;
-			AllocTraits::deallocate(alloc, data_, capacity_);
+			AllocTraits::deallocate(alloc(), ptr(), capacity_);
 		}
 	}
 
@@ -126,10 +160,17 @@ public:
 #pragma region operators
 
 	/// Copy assignment operator. Replaces the contents with a copy of @p rhs.
+	/// The allocator is kept unless AllocatorTraits::PropagateOnContainerCopyAssignment.
 	Vector& operator=(Vector const& rhs) {
 		if (this != &rhs) {
-			this->~Vector();
-			new (this) Vector(rhs);
+			if constexpr (AllocTraits::PropagateOnContainerCopyAssignment::value) {
+				if (!AllocTraits::equal(alloc(), rhs.alloc())) {
+					// the buffer must be given back to the allocator which allocated it
+					release();
+				}
+				alloc() = rhs.alloc();
+			}
+			assign(rhs.ptr(), rhs.size_);
 		}
 		return *this;
 	}
@@ -137,19 +178,25 @@ public:
 	/// Move assignment operator.
 	/// Replaces the contents with those of @p rhs using move semantics
 	/// (i.e., the data in @p rhs is moved from @p rhs into this container).
+	/// The allocator is kept unless AllocatorTraits::PropagateOnContainerMoveAssignment;
+	/// if the allocators aren't equal then, the elements are moved one by one.
 	/// @p rhs is in a valid but unspecified state afterward.
-	Vector& operator=(Vector&& rhs) noexcept {
+	Vector& operator=(Vector&& rhs) noexcept(kMovesBuffer) {
 		if (this != &rhs) {
-			this->~Vector();
-			new (this) Vector(RB_MOVE(rhs));
+			if constexpr (kMovesBuffer) {
+				takeBuffer(rhs);
+			} else if (alloc() == rhs.alloc()) {
+				takeBuffer(rhs);
+			} else {
+				assign(rhs.ptr(), rhs.size_);
+			}
 		}
 		return *this;
 	}
 
 	/// Replaces the contents with those identified by initializer list @p il.
 	Vector& operator=(std::initializer_list<T> il) {
-		this->~Vector();
-		new (this) Vector(il);
+		assign(il.begin(), il.size());
 		return *this;
 	}
 
@@ -157,12 +204,12 @@ public:
 
 	constexpr T const& operator[](usize pos) const {
 		RB_CHECK_RANGE(pos, 0, size_);
-		return data_[pos];
+		return ptr()[pos];
 	}
 
 	constexpr T& operator[](usize pos) {
 		RB_CHECK_RANGE(pos, 0, size_);
-		return data_[pos];
+		return ptr()[pos];
 	}
 
 #pragma endregion operators
@@ -172,11 +219,11 @@ public:
 	// begin/end/range
 
 	constexpr ConstRange range() const noexcept {
-		return {data_, size_};
+		return {ptr(), size_};
 	}
 
 	constexpr Range range() noexcept {
-		return {data_, size_};
+		return {ptr(), size_};
 	}
 
 	constexpr const_iterator begin() const noexcept {
@@ -246,31 +293,36 @@ public:
 	}
 
 	constexpr T const* data() const noexcept {
-		return data_;
+		return ptr();
 	}
 
 	constexpr T* data() noexcept {
-		return data_;
+		return ptr();
+	}
+
+	/// @return the allocator associated with the container.
+	constexpr Alloc allocator() const noexcept {
+		return alloc();
 	}
 
 	constexpr T const& front() const {
 		RB_ASSERT(!empty());
-		return data_[0];
+		return ptr()[0];
 	}
 
 	constexpr T& front() {
 		RB_ASSERT(!empty());
-		return data_[0];
+		return ptr()[0];
 	}
 
 	constexpr T const& back() const {
 		RB_ASSERT(!empty());
-		return data_[size_ - 1];
+		return ptr()[size_ - 1];
 	}
 
 	constexpr T& back() {
 		RB_ASSERT(!empty());
-		return data_[size_ - 1];
+		return ptr()[size_ - 1];
 	}
 
 #pragma endregion container
@@ -292,24 +344,23 @@ public:
 			return;
 		}
 
-		Alloc alloc;
-		auto const newData = AllocTraits::allocate(alloc, newCapacity);
+		auto const newData = AllocTraits::allocate(alloc(), newCapacity);
 		try {
 			if constexpr (core::isNothrowMoveConstructible<T> || !core::isCopyConstructible<T>) {
-				core::uninitializedMove(data_, data_ + size_, newData);
+				core::uninitializedMove(ptr(), ptr() + size_, newData);
 			} else {
-				core::uninitializedCopy(data_, data_ + size_, newData);
+				core::uninitializedCopy(ptr(), ptr() + size_, newData);
 			}
 		} catch (...) {
-			AllocTraits::deallocate(alloc, newData, newCapacity);
+			AllocTraits::deallocate(alloc(), newData, newCapacity);
 			throw;
 		}
 
-		if (data_) {
-			clear();
-			AllocTraits::deallocate(alloc, data_, capacity_);
+		if (ptr()) {
+			core::destroy(ptr(), ptr() + size_);
+			AllocTraits::deallocate(alloc(), ptr(), capacity_);
 		}
-		data_ = newData;
+		ptr() = newData;
 		capacity_ = newCapacity;
 	}
 
@@ -318,16 +369,105 @@ public:
 		RB_NOT_IMPLEMENTED();
 	}
 
+	/// Exchanges the contents and, if AllocatorTraits::PropagateOnContainerSwap, the allocators with @p rhs.
+	/// @pre the allocators are equal unless they propagate on swap
 	constexpr void swap(Vector& rhs) noexcept {
+		AllocTraits::swapOnContainerSwap(alloc(), rhs.alloc());
 		core::swap(size_, rhs.size_);
 		core::swap(capacity_, rhs.capacity_);
-		core::swap(data_, rhs.data_);
+		core::swap(ptr(), rhs.ptr());
 	}
 
 private:
+	static constexpr bool kMovesBuffer = AllocTraits::PropagateOnContainerMoveAssignment::value
+	                                  || AllocTraits::IsAlwaysEqual::value;
+
+	/// Destroys the elements and gives the buffer back to the allocator.
+	void release() noexcept(core::isNothrowDestructible<T>) {
+		if (ptr()) {
+			clear();
+			AllocTraits::deallocate(alloc(), ptr(), capacity_);
+			ptr() = nullptr;
+			capacity_ = 0;
+		}
+	}
+
+	/// Replaces the contents with the buffer of @p rhs, which must be deallocatable by the allocator
+	/// after it has propagated.
+	void takeBuffer(Vector& rhs) noexcept {
+		release();
+		if constexpr (AllocTraits::PropagateOnContainerMoveAssignment::value) {
+			alloc() = RB_MOVE(rhs.alloc());
+		}
+		size_ = core::exchange(rhs.size_, 0);
+		capacity_ = core::exchange(rhs.capacity_, 0);
+		ptr() = core::exchange(rhs.ptr(), nullptr);
+	}
+
+	/// Replaces the contents with @p count elements from @p src, which are copied if @p U is const
+	/// and moved otherwise. The existing elements are assigned to,
+	/// and a new buffer is allocated from alloc() only if the capacity is too small.
+	template <class U>
+	void assign(U* src, usize count) {
+		auto const construct = [](U* first, U* last, T* dst) {
+			if constexpr (core::isConst<U>) {
+				core::uninitializedCopy(first, last, dst);
+			} else {
+				core::uninitializedMove(first, last, dst);
+			}
+		};
+
+		if (count > capacity_) {
+			RB_ASSERT_MSG("Too big capacity", count <= kMaxSize);
+			auto const newData = AllocTraits::allocate(alloc(), count);
+			try {
+				construct(src, src + count, newData);
+			} catch (...) {
+				AllocTraits::deallocate(alloc(), newData, count);
+				throw;
+			}
+			release();
+			ptr() = newData;
+			capacity_ = count;
+			size_ = count;
+			return;
+		}
+
+		usize const assigned = count < size_ ? count : size_;
+		for (usize i = 0; i < assigned; ++i) {
+			if constexpr (core::isConst<U>) {
+				ptr()[i] = src[i];
+			} else {
+				ptr()[i] = RB_MOVE(src[i]);
+			}
+		}
+		if (count > size_) {
+			construct(src + size_, src + count, ptr() + size_);
+		} else {
+			core::destroy(ptr() + count, ptr() + size_);
+		}
+		size_ = count;
+	}
+
+	constexpr T* const& ptr() const noexcept {
+		return storage_.first();
+	}
+
+	constexpr T*& ptr() noexcept {
+		return storage_.first();
+	}
+
+	constexpr Alloc const& alloc() const noexcept {
+		return storage_.second();
+	}
+
+	constexpr Alloc& alloc() noexcept {
+		return storage_.second();
+	}
+
 	usize size_ = 0;
 	usize capacity_ = 0;
-	T* data_ = nullptr;
+	core::CompressedPair<T*, Alloc> storage_;
 };
 
 } // namespace rb::containers
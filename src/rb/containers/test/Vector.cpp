@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <new>
+
+#include <rb/containers/Vector.hpp>
+#include <rb/core/memory/PolymorphicAllocator.hpp>
+
+using namespace rb::core;
+using namespace rb::containers;
+
+namespace {
+
+class CountingResource final : public MemoryResource {
+public:
+	usize allocated = 0;
+	usize deallocated = 0;
+
+private:
+	void* doAllocate(usize bytes, usize align) override {
+		allocated += bytes;
+		return newDeleteResource()->allocate(bytes, align);
+	}
+
+	void doDeallocate(void* ptr, usize bytes, usize align) override {
+		deallocated += bytes;
+		newDeleteResource()->deallocate(ptr, bytes, align);
+	}
+
+	bool doIsEqual(MemoryResource const& rhs) const noexcept override {
+		return this == &rhs;
+	}
+};
+
+} // namespace
+
+TEST_CASE("PolymorphicAllocator", "[containers::Vector]") {
+	CountingResource resource;
+	{
+		Vector<int, PolymorphicAllocator<int>> v({1, 2, 3}, &resource);
+		v.reserve(8);
+		REQUIRE(v.size() == 3);
+		REQUIRE(v[2] == 3);
+		REQUIRE(v.allocator().resource() == &resource);
+		REQUIRE(resource.allocated == 11 * sizeof(int));
+	}
+	REQUIRE(resource.deallocated == resource.allocated);
+
+	Vector<int, PolymorphicAllocator<int>> const empty(nullResource());
+	REQUIRE(empty.empty());
+	REQUIRE_THROWS_AS((Vector<int, PolymorphicAllocator<int>>(1, nullResource())), std::bad_alloc);
+}
+
+TEST_CASE("Allocator is kept", "[containers::Vector]") {
+	CountingResource resource;
+	Vector<int, PolymorphicAllocator<int>> v(&resource);
+	v = {1, 2, 3};
+	REQUIRE(v.size() == 3);
+	REQUIRE(v[2] == 3);
+	REQUIRE(v.allocator().resource() == &resource);
+	REQUIRE(resource.allocated == 3 * sizeof(int));
+
+	v = {4};
+	REQUIRE(v.size() == 1);
+	REQUIRE(v.front() == 4);
+	REQUIRE(resource.allocated == 3 * sizeof(int));
+
+	Vector<int, PolymorphicAllocator<int>> w({5, 6}, &resource);
+	v.swap(w);
+	REQUIRE(v.size() == 2);
+	REQUIRE(v[1] == 6);
+	REQUIRE(w.front() == 4);
+	REQUIRE(v.allocator().resource() == &resource);
+	REQUIRE(w.allocator().resource() == &resource);
+}
+
+TEST_CASE("Assignment keeps the allocator", "[containers::Vector]") {
+	CountingResource resource;
+	CountingResource other;
+	{
+		Vector<int, PolymorphicAllocator<int>> v({1, 2}, &resource);
+		Vector<int, PolymorphicAllocator<int>> const w({3, 4, 5}, &other);
+		v = w;
+		REQUIRE(v.size() == 3);
+		REQUIRE(v[2] == 5);
+		REQUIRE(v.allocator().resource() == &resource);
+		REQUIRE(resource.allocated == 5 * sizeof(int));
+
+		// the allocators differ, so the elements are moved into the own buffer, which is big enough
+		Vector<int, PolymorphicAllocator<int>> u({6}, &other);
+		v = RB_MOVE(u);
+		REQUIRE(v.size() == 1);
+		REQUIRE(v.front() == 6);
+		REQUIRE(v.allocator().resource() == &resource);
+		REQUIRE(resource.allocated == 5 * sizeof(int));
+
+		// equal allocators let the buffer be taken over
+		Vector<int, PolymorphicAllocator<int>> x({7, 8, 9, 10}, &resource);
+		int const* data = x.data();
+		v = RB_MOVE(x);
+		REQUIRE(v.data() == data);
+		REQUIRE(v.size() == 4);
+		REQUIRE(x.empty());
+	}
+	REQUIRE(resource.deallocated == resource.allocated);
+	REQUIRE(other.deallocated == other.allocated);
+}
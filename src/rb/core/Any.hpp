@@ -1,14 +1,30 @@
 #pragma once
 
+#include <new>
 #include <typeinfo>
 
-#include <rb/core/memory/UniquePtr.hpp>
+#include <rb/core/exchange.hpp>
 #include <rb/core/Option.hpp>
+#include <rb/core/traits/CommonType.hpp>
+#include <rb/core/traits/requirements.hpp>
+#include <rb/core/TypeId.hpp>
+#include <rb/core/warnings.hpp>
 
 namespace rb::core {
 
-/// The class Any describes a type-safe container for single values of any copy constructible type.
+RB_WARNING_PUSH
+RB_WARNING_PADDING
+
+/**
+ * The class Any describes a type-safe container for single values of any copy constructible type.
+ *
+ * Nothrow move constructible values of up to #kInlineSize bytes are stored inline, so they never allocate;
+ * larger values live on the heap.
+ * Type-specific operations are dispatched through a static table per type instead of a vtable of a heap object.
+ */
 class RB_EXPORT Any final {
+	struct Ops;
+
 public:
 	template <class T>
 	using Storable = IsCopyConstructible<Decay<T>>;
@@ -18,13 +34,30 @@ public:
 
 	using TypeInfo = std::type_info;
 
+	static constexpr usize kInlineSize = 3 * sizeof(void*);
+	static constexpr usize kInlineAlign = alignof(void*);
+
+	/// Whether a value of type @p T is stored without allocation.
+	template <class T>
+	static constexpr bool kStoredInline = sizeof(T) <= kInlineSize
+	    && kInlineAlign % alignof(T) == 0
+	    && isNothrowMoveConstructible<T>;
+
 	constexpr Any() noexcept = default;
 
-	Any(Any const& rhs)
-	    : storage_(rhs.storage_->clone()) {
+	Any(Any const& rhs) {
+		if (rhs.ops_) {
+			rhs.ops_->copy(storage_, rhs.storage_);
+			ops_ = rhs.ops_;
+		}
 	}
 
-	Any(Any&& rhs) noexcept = default;
+	Any(Any&& rhs) noexcept {
+		if (rhs.ops_) {
+			rhs.ops_->move(storage_, rhs.storage_);
+			ops_ = exchange(rhs.ops_, nullptr);
+		}
+	}
 
 	template <class T,
 	    RB_REQUIRES(!isSame<Decay<T>, Any> && !impl::isInPlaceType<Decay<T>> && kStorable<T>)>
@@ -34,20 +67,32 @@ public:
 
 	template <class T, class... Args,
 	    RB_REQUIRES(kStorable<T>&& isConstructible<Decay<T>, Args...>)>
-	explicit Any(InPlaceType<T> /*unused*/, Args&&... args)
-	    : storage_(StoragePtr<T>::from(RB_FWD(args)...)) {
+	explicit Any(InPlaceType<T> /*unused*/, Args&&... args) {
+		Manager<Decay<T>>::create(storage_, RB_FWD(args)...);
+		ops_ = &Manager<Decay<T>>::kOps;
 	}
 
-	~Any() = default;
+	~Any() {
+		reset();
+	}
 
 	Any& operator=(Any const& rhs) {
 		if (this != &rhs) {
-			storage_ = rhs.storage_->clone();
+			Any(rhs).swap(*this);
 		}
 		return *this;
 	}
 
-	Any& operator=(Any&& rhs) noexcept = default;
+	Any& operator=(Any&& rhs) noexcept {
+		if (this != &rhs) {
+			reset();
+			if (rhs.ops_) {
+				rhs.ops_->move(storage_, rhs.storage_);
+				ops_ = exchange(rhs.ops_, nullptr);
+			}
+		}
+		return *this;
+	}
 
 	template <class T,
 	    RB_REQUIRES(!isSame<Decay<T>, Any> && kStorable<T>)>
@@ -61,13 +106,18 @@ public:
 	}
 
 	[[nodiscard]] constexpr bool hasValue() const noexcept {
-		return static_cast<bool>(storage_);
+		return ops_ != nullptr;
+	}
+
+	/// @return The TypeId of the contained value if instance is non-empty, otherwise the id of `void`.
+	constexpr TypeId typeId() const noexcept {
+		return hasValue() ? ops_->typeId : TypeId();
 	}
 
 #ifdef __cpp_rtti
 	/// @return The `typeid` of the contained value if instance is non-empty, otherwise `typeid(void)`.
-	constexpr TypeInfo const& type() const noexcept {
-		return hasValue() ? storage_->typeInfo() : typeid(void);
+	TypeInfo const& type() const noexcept {
+		return hasValue() ? ops_->type() : typeid(void);
 	}
 #endif
 
@@ -75,16 +125,24 @@ public:
 	template <class T, class... Args,
 	    RB_REQUIRES(kStorable<T>&& isConstructible<Decay<T>, Args...>)>
 	Decay<T>& emplace(Args&&... args) {
-		storage_ = StoragePtr<T>::from(RB_FWD(args)...);
-		return *static_cast<Decay<T>*>(storage_->get());
+		reset();
+		Manager<Decay<T>>::create(storage_, RB_FWD(args)...);
+		ops_ = &Manager<Decay<T>>::kOps;
+		return *static_cast<Decay<T>*>(get());
 	}
 
 	void reset() noexcept {
-		storage_.reset();
+		if (ops_) {
+			exchange(ops_, nullptr)->destroy(storage_);
+		}
 	}
 
-	constexpr void swap(Any& rhs) noexcept {
-		storage_.swap(rhs.storage_);
+	void swap(Any& rhs) noexcept {
+		if (this != &rhs) {
+			Any tmp(RB_MOVE(rhs));
+			rhs = RB_MOVE(*this);
+			*this = RB_MOVE(tmp);
+		}
 	}
 
 private:
@@ -95,95 +153,148 @@ private:
 
 	friend std::ostream& operator<<(std::ostream& os, Any const& any);
 
-	struct IStorage;
-	using IStoragePtr = UniquePtr<IStorage>;
-
-	struct IStorage {
-		IStorage() noexcept = default;
-		RB_DISABLE_COPY(IStorage)
-
-		virtual ~IStorage() = default;
-
-		virtual void const* get() const noexcept = 0;
-
-		virtual IStoragePtr clone() const = 0;
+	union Storage {
+		void* ptr = nullptr;
+		alignas(kInlineAlign) unsigned char buffer[kInlineSize];
+	};
 
+	struct Ops {
+		TypeId typeId;
+		bool isInline;
+		void (*move)(Storage& dst, Storage& src) noexcept; // leaves `src` destroyed
+		void (*copy)(Storage& dst, Storage const& src);
+		void (*destroy)(Storage& storage) noexcept;
 #ifdef __cpp_rtti
-		virtual TypeInfo const& typeInfo() const noexcept = 0;
+		TypeInfo const& (*type)() noexcept;
 #endif
-
-		virtual void print(std::ostream& os) const = 0;
+		void (*print)(std::ostream& os, void const* value);
 	};
 
-	template <class T,
-	    RB_REQUIRES(isCopyConstructible<T>)>
-	struct Storage final : IStorage {
-		explicit Storage(T const& data)
-		    : data(data) {
+	template <class T>
+	struct Manager {
+		static constexpr bool kInline = kStoredInline<T>;
+
+		static T* get(Storage& storage) noexcept {
+			if constexpr (kInline) {
+				return std::launder(reinterpret_cast<T*>(storage.buffer));
+			} else {
+				return static_cast<T*>(storage.ptr);
+			}
 		}
 
-		explicit Storage(T&& data)
-		    : data(RB_MOVE(data)) {
+		static T const* get(Storage const& storage) noexcept {
+			return get(const_cast<Storage&>(storage)); // NOLINT(*-pro-type-const-cast)
 		}
 
-		void const* get() const noexcept override {
-			return addressOf(data);
+		template <class... Args>
+		static void create(Storage& storage, Args&&... args) {
+			if constexpr (kInline) {
+				::new (static_cast<void*>(storage.buffer)) T(RB_FWD(args)...);
+			} else {
+				storage.ptr = new T(RB_FWD(args)...);
+			}
+		}
+
+		static void move(Storage& dst, Storage& src) noexcept {
+			if constexpr (kInline) {
+				::new (static_cast<void*>(dst.buffer)) T(RB_MOVE(*get(src)));
+				get(src)->~T();
+			} else {
+				dst.ptr = exchange(src.ptr, nullptr);
+			}
+		}
+
+		static void copy(Storage& dst, Storage const& src) {
+			create(dst, *get(src));
 		}
 
-		IStoragePtr clone() const override {
-			return UniquePtr<Storage>::from(data);
+		static void destroy(Storage& storage) noexcept {
+			if constexpr (kInline) {
+				get(storage)->~T();
+			} else {
+				delete get(storage);
+			}
 		}
 
 #ifdef __cpp_rtti
-		TypeInfo const& typeInfo() const noexcept override {
+		static TypeInfo const& type() noexcept {
 			return typeid(T);
 		}
 #endif
 
-		void print(std::ostream& os) const override {
+		static void print(std::ostream& os, void const* value) {
 			if constexpr (isWritableTo<T, std::ostream>) {
-				os << data;
+				os << *static_cast<T const*>(value);
 			} else {
 				os << "Any{?}";
 			}
 		}
 
-		T data;
+		static constexpr Ops kOps = {
+		    kTypeId<T>,
+		    kInline,
+		    &move,
+		    &copy,
+		    &destroy,
+#ifdef __cpp_rtti
+		    &type,
+#endif
+		    &print,
+		};
 	};
 
-	template <class T>
-	using StoragePtr = UniquePtr<Storage<Decay<T>>>;
+	void* get() noexcept {
+		return ops_->isInline ? static_cast<void*>(storage_.buffer) : storage_.ptr;
+	}
+
+	void const* get() const noexcept {
+		return ops_->isInline ? static_cast<void const*>(storage_.buffer) : storage_.ptr;
+	}
 
 	template <class T>
 	constexpr void const* cast() const noexcept {
-		// cast<T> returns non-null if type() == typeid(T) and typeid(T) ignores cv-qualifiers so remove them
+		// cast<T> returns non-null if typeId() == kTypeId<T> and TypeId ignores cv-qualifiers so remove them
 		using U = RemoveCv<T>;
 		// - the contained value has a decayed type, so if Decay<U> is not U,
 		//   then it's not possible to have a contained value of type U
 		// - only copy constructible types can be used for contained values
 		if constexpr (!isSame<Decay<U>, U> || !isCopyConstructible<U>) {
 			return nullptr;
+		} else if (ops_ == &Manager<U>::kOps || (ops_ && describes<U>(*ops_))) {
+			return get();
 		}
-#ifdef __cpp_rtti
-		else if (storage_ && type() == typeid(T))
-		{
-			return storage_->get();
+		return nullptr;
+	}
+
+	// The table may be duplicated across shared libraries, so a different table may still describe T.
+	// Equal hashes are only a hint: the types are compared exactly, and types with internal linkage
+	// never match a table of another translation unit.
+	template <class T>
+	static bool describes(Ops const& ops) noexcept {
+		if (ops.typeId != kTypeId<T>) {
+			return false;
 		}
+#ifdef __cpp_rtti
+		return ops.type() == typeid(T);
+#else
+		return ops.typeId.name() == kTypeId<T>.name() && !impl::hasInternalLinkage(kTypeId<T>.name());
 #endif
-		return nullptr;
 	}
 
 	void print(std::ostream& os) const {
-		if (storage_) {
-			storage_->print(os);
+		if (ops_) {
+			ops_->print(os, get());
 		} else {
 			os << "Any{}";
 		}
 	}
 
-	IStoragePtr storage_;
+	Storage storage_;
+	Ops const* ops_ = nullptr;
 };
 
+RB_WARNING_POP
+
 template <class T,
     RB_REQUIRES(isConstructible<T, RemoveCvRef<T> const&>)>
 constexpr Option<T> cast(Any const& any) {
@@ -257,7 +368,107 @@ Any any(Args&&... args) noexcept(isNothrowConstructible<Any, InPlaceType<T>, Arg
 	return Any(kInPlaceType<T>, RB_FWD(args)...);
 }
 
-constexpr void swap(Any& lhs, Any& rhs) noexcept {
+namespace impl::any {
+
+	template <usize n>
+	struct TypeIndex {
+		u64 hashes[n];
+		usize positions[n];
+	};
+
+	/// Sorts the hashes of the alternatives at compile time, so visit() finds the alternative by binary search.
+	template <usize n>
+	constexpr TypeIndex<n> makeTypeIndex(TypeId const (&ids)[n]) noexcept {
+		TypeIndex<n> index{};
+		for (usize i = 0; i < n; ++i) {
+			usize j = i;
+			for (; j > 0 && index.hashes[j - 1] > ids[i].hash(); --j) {
+				index.hashes[j] = index.hashes[j - 1];
+				index.positions[j] = index.positions[j - 1];
+			}
+			index.hashes[j] = ids[i].hash();
+			index.positions[j] = i;
+		}
+		return index;
+	}
+
+	/// @return position of the alternative with @p hash, or @p n if there is none
+	template <usize n>
+	constexpr usize find(TypeIndex<n> const& index, u64 hash) noexcept {
+		usize lo = 0;
+		usize hi = n;
+		while (lo < hi) {
+			usize const mid = lo + (hi - lo) / 2;
+			if (index.hashes[mid] < hash) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		return lo < n && index.hashes[lo] == hash ? index.positions[lo] : n;
+	}
+
+	/// @return whether no two alternatives share a hash, which find() relies on
+	template <usize n>
+	constexpr bool hasDistinctHashes(TypeIndex<n> const& index) noexcept {
+		for (usize i = 1; i < n; ++i) {
+			if (index.hashes[i - 1] == index.hashes[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <class AnyRef, class T>
+	using Alternative = Conditional<isConst<RemoveRef<AnyRef>>, T const&, T&>;
+
+	template <class R, class F, class AnyRef, class T>
+	R visitAlternative(F& fn, RemoveRef<AnyRef>& any) {
+		// the hashes of different types may collide
+		auto* value = cast<T>(&any);
+		if (!value) {
+			return invoke(static_cast<F&&>(fn), kNone);
+		}
+		return invoke(static_cast<F&&>(fn), static_cast<Alternative<AnyRef, T>>(*value));
+	}
+
+	template <class R, class F, class AnyRef>
+	R visitNone(F& fn, RemoveRef<AnyRef>& /*unused*/) {
+		return invoke(static_cast<F&&>(fn), kNone);
+	}
+
+} // namespace impl::any
+
+/**
+ * Calls @p fn with a reference to the value contained in @p any if its type is one of @p Ts,
+ * or with `kNone` if @p any is empty or holds some other type.
+ *
+ * The alternative is looked up by a binary search over TypeId hashes sorted at compile time
+ * and called through a jump table, instead of trying `cast` for each of @p Ts in turn.
+ * @return the result of the call converted to the common type of all possible calls
+ */
+template <class... Ts, class A, class F,
+    RB_REQUIRES(isSame<RemoveCvRef<A>, Any>)>
+decltype(auto) visit(A&& any, F&& fn) {
+	static_assert(sizeof...(Ts) > 0, "there must be at least one alternative");
+	static_assert((isSame<Decay<Ts>, Ts> && ...), "alternatives must be decayed types");
+
+	using R = CommonType<InvokeResult<F, impl::any::Alternative<A, Ts>>..., InvokeResult<F, NoneOption const&>>;
+	using Visitor = R (*)(F&, RemoveRef<A>&);
+	constexpr usize n = sizeof...(Ts);
+	constexpr TypeId ids[n] = {kTypeId<Ts>...};
+	static constexpr impl::any::TypeIndex<n> kIndex = impl::any::makeTypeIndex(ids);
+	static_assert(impl::any::hasDistinctHashes(kIndex), "alternatives must have distinct TypeId hashes");
+	static constexpr Visitor kTable[n + 1] = {
+	    &impl::any::visitAlternative<R, F, A, Ts>...,
+	    &impl::any::visitNone<R, F, A>,
+	};
+
+	usize const position = any.hasValue() ? impl::any::find(kIndex, any.typeId().hash()) : n;
+	return kTable[position](fn, any);
+}
+
+inline void swap(Any& lhs, Any& rhs) noexcept {
 	lhs.swap(rhs);
 }
 
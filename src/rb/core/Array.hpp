@@ -3,15 +3,17 @@
 #include <rb/core/error/RangeError.hpp>
 #include <rb/core/memory/allocators.hpp>
 #include <rb/core/memory/AllocatorTraits.hpp>
+#include <rb/core/memory/CompressedPair.hpp>
 #include <rb/core/Span.hpp>
+#include <rb/ext/ZeroMemory.hpp>
 
 namespace rb::core {
 
-template <class T>
+template <class T, class Alloc = ArrayAllocator<T>>
 class Array;
 
-template <class T>
-struct ContainerTraits<Array<T>> {
+template <class T, class Alloc>
+struct ContainerTraits<Array<T, Alloc>> {
 	using Value = T;
 	using Iterator = T*;
 	using ConstIterator = T const*;
@@ -20,11 +22,12 @@ struct ContainerTraits<Array<T>> {
 };
 
 /// Owning counterpart of rb::core::Span, or std::unique_ptr<T[]> with `size()`, or std::vector<T> without resizing.
-template <class T>
-class RB_EXPORT Array final : public Sliceable<Array<T>, Span<T const>, Span<T>> {
+/// Memory is obtained from @p Alloc; stateless allocators take no space.
+template <class T, class Alloc>
+class RB_EXPORT Array final : public Sliceable<Array<T, Alloc>, Span<T const>, Span<T>> {
 	using Super = Sliceable<Array, Span<T const>, Span<T>>;
-	using Alloc = ArrayAllocator<T>;
 	using AllocTraits = AllocatorTraits<Alloc>;
+	static_assert(isSame<typename AllocTraits::Value, T>, "Alloc::Value must be the same as T");
 
 	enum class Op {
 		kDefault,
@@ -37,46 +40,63 @@ public:
 
 	using Pointer = T*;
 	using ConstPointer = T const*;
+	using Allocator = Alloc;
 
 	template <bool _ = true, RB_REQUIRES(_&& isDefaultConstructible<T>)>
-	explicit Array(usize size) noexcept(isNothrowDefaultConstructible<T>) {
+	explicit Array(usize size, Alloc const& a = Alloc())
+	    : storage_{kInPlaceIndex<1>, a, nullptr} {
 		init<Op::kDefault>(nullptr, size);
 	}
 
+	/// Creates an array of @p size zero-initialized elements without constructing them one by one;
+	/// the memory isn't even touched if the allocator knows it is zero-filled (see AllocatorTraits::allocateZeroed()).
+	template <bool _ = true, RB_REQUIRES(_&& isTriviallyDefaultConstructible<T> && isTriviallyDestructible<T>)>
+	Array(usize size, ext::ZeroMemory /*kZeroMemory*/, Alloc const& a = Alloc())
+	    : size_{size}
+	    , storage_{kInPlaceIndex<1>, a, nullptr} {
+		ptr() = AllocTraits::allocateZeroed(alloc(), size_);
+	}
+
 	// elements of an initializer list are always passed via const reference,
 	// so we can't use an initializer list with move-only types (but can declare it, meh);
 	// use a plain array in such a case
 	template <bool _ = true, RB_REQUIRES(_&& isCopyConstructible<T>)>
-	Array(std::initializer_list<T> il) noexcept(isNothrowCopyConstructible<T>) {
+	Array(std::initializer_list<T> il, Alloc const& a = Alloc())
+	    : storage_{kInPlaceIndex<1>, a, nullptr} {
 		init(il.begin(), il.size());
 	}
 
 	template <usize n,
 	    bool _ = true, RB_REQUIRES(_&& isCopyConstructible<T>)>
-	explicit Array(T const (&a)[n]) noexcept(isNothrowCopyConstructible<T>) {
+	explicit Array(T const (&a)[n])
+	    : storage_{kInPlaceIndex<0>, nullptr} {
 		init(a, n);
 	}
 
 	template <usize n,
 	    bool _ = true, RB_REQUIRES(_&& isMoveConstructible<T>)>
-	explicit Array(T (&&a)[n]) noexcept(isNothrowMoveConstructible<T>) {
+	explicit Array(T (&&a)[n])
+	    : storage_{kInPlaceIndex<0>, nullptr} {
 		init<Op::kMove>(a, n);
 	}
 
 	template <usize n,
 	    bool _ = true, RB_REQUIRES(_&& isCopyConstructible<T>)>
-	explicit Array(std::array<T, n> const& a) noexcept(isNothrowCopyConstructible<T>) {
+	explicit Array(std::array<T, n> const& a)
+	    : storage_{kInPlaceIndex<0>, nullptr} {
 		init(a.data(), n);
 	}
 
 	template <usize n,
 	    bool _ = true, RB_REQUIRES(_&& isMoveConstructible<T>)>
-	explicit Array(std::array<T, n>&& a) noexcept(isNothrowMoveConstructible<T>) {
+	explicit Array(std::array<T, n>&& a)
+	    : storage_{kInPlaceIndex<0>, nullptr} {
 		init<Op::kMove>(a.data(), n);
 	}
 
 	template <class InputIt>
-	Array(InputIt first, InputIt last) noexcept(isNothrowCopyConstructible<T>) {
+	Array(InputIt first, InputIt last, Alloc const& a = Alloc())
+	    : storage_{kInPlaceIndex<1>, a, nullptr} {
 		init(first, last - first);
 	}
 
@@ -84,21 +104,21 @@ public:
 
 	constexpr Array(Array&& rhs) noexcept
 	    : size_{rhs.size_}
-	    , data_{rhs.data_} {
+	    , storage_{kInPlaceIndex<1>, RB_MOVE(rhs.alloc()), rhs.ptr()} {
 		rhs.size_ = 0;
-		rhs.data_ = nullptr;
+		rhs.ptr() = nullptr;
 	}
 
 	~Array() {
-		if (!data_ || !size_) {
+		if (!ptr()) {
 			return;
 		}
 
-		Alloc alloc;
-		for (Pointer ptr = data_ + size_ - 1; ptr >= data_; --ptr) {
-			AllocTraits::destroy(alloc, ptr);
+		// empty arrays still own their block, e.g. a whole page for MmapAllocator
+		for (Pointer p = ptr() + size_; p != ptr();) {
+			AllocTraits::destroy(alloc(), --p);
 		}
-		Alloc::deallocate(data_, size_);
+		AllocTraits::deallocate(alloc(), ptr(), size_);
 	}
 
 	Array& operator=(Array const&) = delete;
@@ -115,52 +135,57 @@ public:
 
 	constexpr T const& operator[](usize idx) const {
 		RB_CHECK_RANGE(idx, 0, size_);
-		return data_[idx];
+		return ptr()[idx];
 	}
 
 	constexpr T& operator[](usize idx) {
 		RB_CHECK_RANGE(idx, 0, size_);
-		return data_[idx];
+		return ptr()[idx];
 	}
 
 #pragma region STL
 
 	constexpr Iterator begin() noexcept {
-		return data_;
+		return ptr();
 	}
 
 	constexpr ConstIterator begin() const noexcept {
-		return data_;
+		return ptr();
 	}
 
 	constexpr ConstIterator cbegin() const noexcept {
-		return data_;
+		return ptr();
 	}
 
 	constexpr Iterator end() noexcept {
-		return data_ + size_;
+		return ptr() + size_;
 	}
 
 	constexpr ConstIterator end() const noexcept {
-		return data_ + size_;
+		return ptr() + size_;
 	}
 
 	constexpr ConstIterator cend() const noexcept {
-		return data_ + size_;
+		return ptr() + size_;
 	}
 
 	constexpr ConstPointer data() const noexcept {
-		return data_;
+		return ptr();
 	}
 
 	constexpr Pointer data() noexcept {
-		return data_;
+		return ptr();
 	}
 
 	constexpr usize size() const noexcept {
 		return size_;
 	}
 
+	/// @return the allocator associated with the array.
+	constexpr Alloc allocator() const noexcept {
+		return alloc();
+	}
+
 	[[nodiscard]] constexpr bool empty() const noexcept {
 		return size_ == 0;
 	}
@@ -173,28 +198,44 @@ private:
 	template <Op op = Op::kCopy, class It>
 	void init(It first, usize size) {
 		size_ = size;
-		data_ = Alloc::allocate(size_);
-		Alloc alloc;
+		ptr() = AllocTraits::allocate(alloc(), size_);
+		Pointer const data = ptr();
 		usize idx = 0;
 		try {
 			for (; idx < size_; ++idx) {
 				if constexpr (op == Op::kDefault) {
-					AllocTraits::construct(alloc, data_ + idx);
+					AllocTraits::construct(alloc(), data + idx);
 				} else if constexpr (op == Op::kCopy) {
-					AllocTraits::construct(alloc, data_ + idx, *first++);
+					AllocTraits::construct(alloc(), data + idx, *first++);
 				} else {
-					AllocTraits::construct(alloc, data_ + idx, RB_MOVE(*first++));
+					AllocTraits::construct(alloc(), data + idx, RB_MOVE(*first++));
 				}
 			}
 		} catch (...) {
-			destroy(data_, data_ + idx, alloc);
-			Alloc::deallocate(data_, size_);
+			destroy(data, data + idx, alloc());
+			AllocTraits::deallocate(alloc(), data, size_);
 			throw;
 		}
 	}
 
+	constexpr Pointer const& ptr() const noexcept {
+		return storage_.first();
+	}
+
+	constexpr Pointer& ptr() noexcept {
+		return storage_.first();
+	}
+
+	constexpr Alloc const& alloc() const noexcept {
+		return storage_.second();
+	}
+
+	constexpr Alloc& alloc() noexcept {
+		return storage_.second();
+	}
+
 	usize size_ = 0;
-	Pointer data_ = nullptr;
+	CompressedPair<Pointer, Alloc> storage_;
 };
 
 template <class T, usize n,
@@ -217,9 +258,9 @@ template <class T, usize n,
 	return Array<RemoveCv<T>>(RB_MOVE(a));
 }
 
-template <class T,
+template <class T, class Alloc,
     RB_REQUIRES_T(IsWritableTo<T, std::ostream>)>
-std::ostream& operator<<(std::ostream& os, Array<T> const& array) {
+std::ostream& operator<<(std::ostream& os, Array<T, Alloc> const& array) {
 	return fmt::pprint(os, array, "[", "]", ", ");
 }
 
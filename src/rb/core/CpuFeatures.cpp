@@ -0,0 +1,142 @@
+#include "CpuFeatures.hpp"
+
+#include <rb/core/os.hpp>
+
+#if defined(RB_PROCESSOR_X86)
+	#if defined(RB_COMPILER_MSVC)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#elif defined(RB_PROCESSOR_ARM) && defined(RB_OS_LINUX)
+	#include <sys/auxv.h>
+#endif
+
+using namespace rb::core;
+
+namespace {
+
+#if defined(RB_PROCESSOR_X86)
+
+struct CpuId {
+	u32 eax;
+	u32 ebx;
+	u32 ecx;
+	u32 edx;
+};
+
+CpuId cpuId(u32 leaf, u32 subleaf = 0) noexcept {
+	CpuId regs{};
+	#if defined(RB_COMPILER_MSVC)
+	int out[4];
+	__cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+	regs = {static_cast<u32>(out[0]), static_cast<u32>(out[1]), static_cast<u32>(out[2]), static_cast<u32>(out[3])};
+	#else
+	__cpuid_count(leaf, subleaf, regs.eax, regs.ebx, regs.ecx, regs.edx);
+	#endif
+	return regs;
+}
+
+// the register state the OS saves on context switches; @pre OSXSAVE
+u64 enabledXState() noexcept {
+	#if defined(RB_COMPILER_MSVC)
+	return _xgetbv(0);
+	#else
+	u32 lo = 0;
+	u32 hi = 0;
+	__asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return (u64{hi} << 32) | lo;
+	#endif
+}
+
+CpuFeatures detect() noexcept {
+	CpuFeatures features;
+	u32 const maxLeaf = cpuId(0).eax;
+	if (maxLeaf < 1) {
+		return features;
+	}
+
+	auto const set = [&features](u32 reg, unsigned bit, CpuFeature feature) {
+		features.setFlag(feature, (reg >> bit) & 1U);
+	};
+
+	CpuId const leaf1 = cpuId(1);
+	set(leaf1.edx, 26, CpuFeature::kSse2);
+	set(leaf1.ecx, 1, CpuFeature::kPclmul);
+	set(leaf1.ecx, 9, CpuFeature::kSsse3);
+	set(leaf1.ecx, 19, CpuFeature::kSse41);
+	set(leaf1.ecx, 20, CpuFeature::kSse42);
+	set(leaf1.ecx, 23, CpuFeature::kPopcnt);
+
+	// AVX registers are only usable if the OS saves them (XMM and YMM state, and also opmask and ZMM for AVX-512)
+	bool const osXSave = (leaf1.ecx >> 27) & 1U;
+	u64 const xState = osXSave ? enabledXState() : 0;
+	bool const avxState = (xState & 0x06) == 0x06;
+	bool const avx512State = (xState & 0xe6) == 0xe6;
+	if (avxState) {
+		set(leaf1.ecx, 12, CpuFeature::kFma);
+		set(leaf1.ecx, 28, CpuFeature::kAvx);
+	}
+
+	if (maxLeaf >= 7) {
+		CpuId const leaf7 = cpuId(7);
+		set(leaf7.ebx, 3, CpuFeature::kBmi1);
+		set(leaf7.ebx, 8, CpuFeature::kBmi2);
+		if (avxState) {
+			set(leaf7.ebx, 5, CpuFeature::kAvx2);
+		}
+		if (avx512State) {
+			set(leaf7.ebx, 16, CpuFeature::kAvx512F);
+			set(leaf7.ebx, 30, CpuFeature::kAvx512Bw);
+			set(leaf7.ebx, 31, CpuFeature::kAvx512Vl);
+		}
+	}
+	return features;
+}
+
+#elif defined(RB_PROCESSOR_ARM)
+
+CpuFeatures detect() noexcept {
+	CpuFeatures features;
+	#if defined(RB_PROCESSOR_ARM_64)
+	// Advanced SIMD is mandatory for AArch64
+	features |= CpuFeature::kNeon;
+	#endif
+
+	#if defined(RB_OS_LINUX)
+	// the values of HWCAP_* from <asm/hwcap.h>, which are stable kernel ABI
+	unsigned long const hwCap = getauxval(AT_HWCAP);
+		#if defined(RB_PROCESSOR_ARM_64)
+	unsigned long const hwCap2 = getauxval(AT_HWCAP2);
+	features.setFlag(CpuFeature::kSve, hwCap & (1UL << 22));
+	features.setFlag(CpuFeature::kSve2, hwCap2 & (1UL << 1));
+		#else
+	features.setFlag(CpuFeature::kNeon, hwCap & (1UL << 12));
+		#endif
+	#elif defined(__ARM_NEON)
+	features |= CpuFeature::kNeon;
+	#endif
+	return features;
+}
+
+#else
+
+CpuFeatures detect() noexcept {
+	return {};
+}
+
+#endif
+
+} // namespace
+
+CpuFeatures rb::core::cpuFeatures() noexcept {
+	static CpuFeatures const features = detect();
+	return features;
+}
+
+namespace {
+
+// detect the features during the static initialization, so kernels don't pay for `cpuid` on their first call
+[[maybe_unused]] CpuFeatures const kDetectedAtStartup = cpuFeatures();
+
+} // namespace
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <initializer_list>
+
+#include <rb/core/compiler.hpp>
+#include <rb/core/export.hpp>
+#include <rb/core/Flags.hpp>
+#include <rb/core/processor.hpp>
+#include <rb/core/types.hpp>
+#include <rb/core/warnings.hpp>
+
+/// Compiles the function for the instruction set extensions @p features (e.g. `RB_TARGET("avx2,bmi2")`),
+/// so it may use their intrinsics in a translation unit built for the baseline ISA.
+/// Such functions must only be called when the running CPU supports them, see RB_MULTIVERSION.
+#if defined(RB_COMPILER_GCC_LIKE) && (defined(RB_PROCESSOR_X86) || defined(RB_PROCESSOR_ARM))
+	#define RB_TARGET(features) __attribute__((target(features)))
+#else
+	#define RB_TARGET(features)
+#endif
+
+/**
+ * Dispatches a call to the first kernel supported by the running CPU, e.g.
+ * @code
+ * RB_MULTIVERSION(sumScalar, {CpuFeature::kAvx2, sumAvx2}, {CpuFeature::kSse42, sumSse42})(data, size);
+ * @endcode
+ * The kernels are tried in order, @p fallback is used when none of them is supported.
+ * The kernel is selected once per call site, on the first call, and cached in a function pointer afterwards.
+ */
+#define RB_MULTIVERSION(fallback, ...)                                                     \
+	([]() noexcept {                                                                       \
+		static auto* const rbKernel = ::rb::core::selectKernel(fallback, {__VA_ARGS__}); \
+		return rbKernel;                                                                   \
+	}())
+
+namespace rb::core {
+
+enum class CpuFeature : u32 {
+	kNone = 0,
+	// x86
+	kSse2 = 1U << 0,
+	kSsse3 = 1U << 1,
+	kSse41 = 1U << 2,
+	kSse42 = 1U << 3,
+	kPopcnt = 1U << 4,
+	kPclmul = 1U << 5,
+	kAvx = 1U << 6,
+	kAvx2 = 1U << 7,
+	kFma = 1U << 8,
+	kBmi1 = 1U << 9,
+	kBmi2 = 1U << 10,
+	kAvx512F = 1U << 11,
+	kAvx512Bw = 1U << 12,
+	kAvx512Vl = 1U << 13,
+	// ARM
+	kNeon = 1U << 16,
+	kSve = 1U << 17,
+	kSve2 = 1U << 18,
+};
+
+using CpuFeatures = Flags<CpuFeature>;
+
+/// @return the features of the running CPU which are also enabled by the OS; detected once, on the first call.
+RB_EXPORT CpuFeatures cpuFeatures() noexcept;
+
+/// @return @c true if the running CPU supports all @p features.
+inline bool hasCpuFeatures(CpuFeatures features) noexcept {
+	return (cpuFeatures() & features) == features;
+}
+
+RB_WARNING_PUSH
+RB_WARNING_PADDING
+
+template <class Fn>
+struct Kernel {
+	CpuFeatures required;
+	Fn* fn;
+};
+
+RB_WARNING_POP
+
+/// @return the first of @p kernels whose required features are supported by the running CPU, or @p fallback.
+template <class Fn>
+Fn* selectKernel(Fn* fallback, std::initializer_list<Kernel<Fn>> kernels) noexcept {
+	for (auto const& kernel : kernels) {
+		if (hasCpuFeatures(kernel.required)) {
+			return kernel.fn;
+		}
+	}
+	return fallback;
+}
+
+} // namespace rb::core
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <rb/core/assert.hpp>
+#include <rb/core/bits.hpp>
+#include <rb/core/int128.hpp>
+#include <rb/core/quorem.hpp>
+#include <rb/core/traits/IsSigned.hpp>
+#include <rb/core/traits/Unsigned.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+
+namespace impl::divider {
+
+	template <class U>
+	constexpr U mulHi(U lhs, U rhs) noexcept {
+		if constexpr (sizeof(U) == 4) {
+			return static_cast<U>((u64{lhs} * rhs) >> 32);
+		} else {
+			u64 hi = 0;
+			(void) int128::mulWide(lhs, rhs, hi);
+			return hi;
+		}
+	}
+
+	// the high half of the signed product, computed from the unsigned one
+	template <class T>
+	constexpr T mulHiSigned(T lhs, T rhs) noexcept {
+		using U = Unsigned<T>;
+		U hi = mulHi(static_cast<U>(lhs), static_cast<U>(rhs));
+		hi -= lhs < 0 ? static_cast<U>(rhs) : 0;
+		hi -= rhs < 0 ? static_cast<U>(lhs) : 0;
+		return static_cast<T>(hi);
+	}
+
+	/// @return `(hi * 2^bits + lo) / divisor`; @pre `hi < divisor`
+	template <class U>
+	constexpr U divWide(U hi, U lo, U divisor, U& rem) noexcept {
+		if constexpr (sizeof(U) == 4) {
+			u64 const dividend = (u64{hi} << 32) | lo;
+			rem = static_cast<U>(dividend % divisor);
+			return static_cast<U>(dividend / divisor);
+		} else {
+			return int128::divWide(hi, lo, divisor, rem);
+		}
+	}
+
+} // namespace impl::divider
+
+RB_WARNING_PUSH
+RB_WARNING_PADDING
+
+/**
+ * Divider replaces division by a runtime-invariant divisor with a multiplication and shifts,
+ * like compilers do for constant divisors (see [libdivide](https://libdivide.com)).
+ * Constructing a divider costs a hardware division, so it pays off when the same divisor is used repeatedly,
+ * e.g. for reducing hashes modulo the number of buckets.
+ *
+ * The branch-free variant (see BranchFreeDivider) has no data-dependent branches, which suits vectorized loops,
+ * but is slightly slower for scalars; for unsigned types it doesn't support the divisor 1.
+ * @tparam T a 32-bit or 64-bit integral type
+ */
+template <class T, bool kBranchFree = false>
+class Divider {
+	static_assert(isIntegral<T> && !isSame<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+	using U = Unsigned<T>;
+
+	static constexpr unsigned kBits = 8 * sizeof(T);
+	static constexpr u8 kShiftMask = kBits - 1;
+	static constexpr u8 kAddMarker = 0x40;
+	static constexpr u8 kNegativeDivisor = 0x80;
+
+public:
+	constexpr explicit Divider(T divisor) noexcept
+	    : divisor_{divisor} {
+		RB_ASSERT_MSG("division by zero", divisor != 0);
+		if constexpr (isSigned<T>) {
+			initSigned();
+		} else {
+			RB_ASSERT_MSG("branch-free divider doesn't support 1", !kBranchFree || divisor != 1);
+			initUnsigned();
+		}
+	}
+
+	constexpr T divisor() const noexcept {
+		return divisor_;
+	}
+
+	/// @return @p dividend / divisor(), rounded towards zero like the built-in division.
+	constexpr T divide(T dividend) const noexcept {
+		if constexpr (isSigned<T>) {
+			return divideSigned(dividend);
+		} else {
+			return divideUnsigned(dividend);
+		}
+	}
+
+	friend constexpr T operator/(T dividend, Divider const& divisor) noexcept {
+		return divisor.divide(dividend);
+	}
+
+	friend constexpr T operator%(T dividend, Divider const& divisor) noexcept {
+		return quorem(dividend, divisor).rem;
+	}
+
+	friend constexpr QuoRem<T> quorem(T dividend, Divider const& divisor) noexcept {
+		T const quo = divisor.divide(dividend);
+		auto const rem = static_cast<U>(dividend) - static_cast<U>(quo) * static_cast<U>(divisor.divisor_);
+		return {quo, static_cast<T>(rem)};
+	}
+
+private:
+	constexpr void initUnsigned() noexcept {
+		auto const d = static_cast<U>(divisor_);
+		auto const floorLog2 = static_cast<u8>(kBits - 1 - countLeadingZeroes(d));
+		if ((d & (d - 1)) == 0) {
+			more_ = static_cast<u8>(floorLog2 - kBranchFree);
+			return;
+		}
+
+		U rem = 0;
+		U m = impl::divider::divWide(U{1} << floorLog2, U{0}, d, rem);
+		U const e = d - rem;
+		if (!kBranchFree && e < (U{1} << floorLog2)) {
+			// 2^(bits + floorLog2) / d fits into the word, so the quotient is just shifted
+			more_ = floorLog2;
+		} else {
+			// otherwise the magic number has bits + 1 bits, its top bit is added back while dividing
+			m += m;
+			U const twiceRem = rem + rem;
+			if (twiceRem >= d || twiceRem < rem) {
+				m += 1;
+			}
+			more_ = kBranchFree ? floorLog2 : static_cast<u8>(floorLog2 | kAddMarker);
+		}
+		magic_ = m + 1;
+	}
+
+	constexpr void initSigned() noexcept {
+		U const absD = divisor_ < 0 ? -static_cast<U>(divisor_) : static_cast<U>(divisor_);
+		auto const floorLog2 = static_cast<u8>(kBits - 1 - countLeadingZeroes(absD));
+		u8 const negative = divisor_ < 0 ? kNegativeDivisor : 0;
+		if ((absD & (absD - 1)) == 0) {
+			more_ = floorLog2 | negative;
+			return;
+		}
+
+		U rem = 0;
+		U m = impl::divider::divWide(U{1} << (floorLog2 - 1), U{0}, absD, rem);
+		U const e = absD - rem;
+		if (!kBranchFree && e < (U{1} << floorLog2)) {
+			more_ = static_cast<u8>(floorLog2 - 1);
+		} else {
+			m += m;
+			U const twiceRem = rem + rem;
+			if (twiceRem >= absD || twiceRem < rem) {
+				m += 1;
+			}
+			more_ = kBranchFree ? floorLog2 : static_cast<u8>(floorLog2 | kAddMarker);
+		}
+		m += 1;
+		// the branch-free division applies the sign of the divisor to the quotient instead
+		magic_ = divisor_ < 0 && !kBranchFree ? -m : m;
+		more_ |= negative;
+	}
+
+	constexpr T divideUnsigned(T dividend) const noexcept {
+		auto const n = static_cast<U>(dividend);
+		if constexpr (kBranchFree) {
+			U const q = impl::divider::mulHi(magic_, n);
+			return static_cast<T>((((n - q) >> 1) + q) >> more_);
+		} else {
+			if (!magic_) {
+				return static_cast<T>(n >> more_);
+			}
+			U const q = impl::divider::mulHi(magic_, n);
+			if (more_ & kAddMarker) {
+				return static_cast<T>((((n - q) >> 1) + q) >> (more_ & kShiftMask));
+			}
+			return static_cast<T>(q >> more_);
+		}
+	}
+
+	constexpr T divideSigned(T dividend) const noexcept {
+		auto const n = static_cast<U>(dividend);
+		unsigned const shift = more_ & kShiftMask;
+		// all ones for a negative divisor
+		auto const sign = static_cast<U>(-static_cast<T>(more_ >> 7));
+		auto const magic = static_cast<T>(magic_);
+		if constexpr (kBranchFree) {
+			U q = static_cast<U>(impl::divider::mulHiSigned(magic, dividend)) + n;
+			// a negative quotient is rounded towards zero
+			U const qSign = static_cast<U>(static_cast<T>(q) >> (kBits - 1));
+			q += qSign & ((U{1} << shift) - (magic == 0));
+			q = static_cast<U>(static_cast<T>(q) >> shift);
+			return static_cast<T>((q ^ sign) - sign);
+		} else {
+			if (!magic) {
+				U const mask = (U{1} << shift) - 1;
+				U const uq = n + (static_cast<U>(dividend >> (kBits - 1)) & mask);
+				auto const q = static_cast<U>(static_cast<T>(uq) >> shift);
+				return static_cast<T>((q ^ sign) - sign);
+			}
+			auto uq = static_cast<U>(impl::divider::mulHiSigned(magic, dividend));
+			if (more_ & kAddMarker) {
+				uq += (n ^ sign) - sign;
+			}
+			auto q = static_cast<T>(static_cast<T>(uq) >> shift);
+			q += q < 0;
+			return q;
+		}
+	}
+
+	T divisor_;
+	U magic_ = 0;
+	u8 more_ = 0;
+};
+
+RB_WARNING_POP
+
+template <class T>
+using BranchFreeDivider = Divider<T, true>;
+
+} // namespace rb::core
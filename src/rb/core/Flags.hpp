@@ -91,6 +91,14 @@ public:
 		return Flags(*this) ^= flag;
 	}
 
+	constexpr bool operator==(Flags rhs) const noexcept {
+		return value_ == rhs.value_;
+	}
+
+	constexpr bool operator!=(Flags rhs) const noexcept {
+		return value_ != rhs.value_;
+	}
+
 	constexpr Flags& setFlag(E flag, bool on = true) noexcept {
 		auto const value = toUnderlying(flag);
 		on ? (value_ |= value) : (value_ &= ~value);
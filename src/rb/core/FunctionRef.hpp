@@ -0,0 +1,117 @@
+#pragma once
+
+#include <rb/core/assert.hpp>
+#include <rb/core/invoke.hpp>
+#include <rb/core/memory/addressOf.hpp>
+#include <rb/core/traits/Conditional.hpp>
+#include <rb/core/traits/Decay.hpp>
+#include <rb/core/traits/IsBaseOf.hpp>
+#include <rb/core/traits/IsFunction.hpp>
+#include <rb/core/traits/IsPointer.hpp>
+#include <rb/core/traits/remove.hpp>
+
+namespace rb::core {
+
+namespace impl::function {
+
+	template <class F>
+	inline constexpr bool isFunctionPointer = isPointer<F> && isFunction<RemovePointer<F>>;
+
+	/// The callable as it's invoked by a wrapper with a const or a non-const signature.
+	template <class F, bool kConst>
+	using Callee = Conditional<kConst, F const&, F&>;
+
+	template <class F, bool kNoexcept, class R, class... Args>
+	inline constexpr bool kInvocable = kNoexcept
+	    ? isNothrowInvocableR<R, F, Args...>
+	    : isInvocableR<R, F, Args...>;
+
+	template <bool kConst, bool kNoexcept, class R, class... Args>
+	class FunctionRefBase {
+		union Target {
+			void const* object;
+			void (*function)();
+		};
+
+		template <class F>
+		static constexpr bool kAccepts = !isBaseOf<FunctionRefBase, RemoveCvRef<F>>
+		    && (isFunctionPointer<Decay<F>>
+		            ? kInvocable<Decay<F>, kNoexcept, R, Args...>
+		            : kInvocable<Callee<RemoveRef<F>, kConst>, kNoexcept, R, Args...>);
+
+	public:
+		/// Binds to a function or to a callable object, which has to outlive the reference.
+		template <class F, RB_REQUIRES(kAccepts<F>)>
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		FunctionRefBase(F&& f) noexcept { // NOLINT(*-forwarding-reference-overload, google-explicit-constructor)
+			if constexpr (isFunctionPointer<Decay<F>>) {
+				Decay<F> const ptr = f;
+				RB_ASSERT_MSG("FunctionRef to a null function", ptr != nullptr);
+				target_.function = reinterpret_cast<void (*)()>(ptr); // NOLINT(*-reinterpret-cast)
+				invoker_ = &callFunction<Decay<F>>;
+			} else {
+				target_.object = addressOf(f);
+				invoker_ = &callObject<RemoveRef<F>>;
+			}
+		}
+
+		R operator()(Args... args) const noexcept(kNoexcept) {
+			return invoker_(target_, RB_FWD(args)...);
+		}
+
+	private:
+		using Invoker = R (*)(Target, Args&&...) noexcept(kNoexcept);
+
+		template <class F>
+		static R callFunction(Target target, Args&&... args) noexcept(kNoexcept) {
+			return invokeR<R>(reinterpret_cast<F>(target.function), RB_FWD(args)...); // NOLINT(*-reinterpret-cast)
+		}
+
+		template <class F>
+		static R callObject(Target target, Args&&... args) noexcept(kNoexcept) {
+			// the object was bound as non-const if the signature is non-const
+			auto* const object = const_cast<F*>(static_cast<F const*>(target.object)); // NOLINT(*-const-cast)
+			return invokeR<R>(static_cast<Callee<F, kConst>>(*object), RB_FWD(args)...);
+		}
+
+		Target target_;
+		Invoker invoker_;
+	};
+
+} // namespace impl::function
+
+/**
+ * FunctionRef is a non-owning reference to a callable with signature @p Sig, e.g. `int(char) const noexcept`.
+ *
+ * It's two pointers wide, never allocates and is trivially copyable, so it's the cheap way to pass
+ * a callback down the stack; the referenced callable must outlive every call.
+ * A const signature calls the callable as const, a `noexcept` one requires it to be nothrow invocable.
+ */
+template <class Sig>
+class FunctionRef;
+
+template <class R, class... Args>
+class FunctionRef<R(Args...)> final : public impl::function::FunctionRefBase<false, false, R, Args...> {
+public:
+	using impl::function::FunctionRefBase<false, false, R, Args...>::FunctionRefBase;
+};
+
+template <class R, class... Args>
+class FunctionRef<R(Args...) const> final : public impl::function::FunctionRefBase<true, false, R, Args...> {
+public:
+	using impl::function::FunctionRefBase<true, false, R, Args...>::FunctionRefBase;
+};
+
+template <class R, class... Args>
+class FunctionRef<R(Args...) noexcept> final : public impl::function::FunctionRefBase<false, true, R, Args...> {
+public:
+	using impl::function::FunctionRefBase<false, true, R, Args...>::FunctionRefBase;
+};
+
+template <class R, class... Args>
+class FunctionRef<R(Args...) const noexcept> final : public impl::function::FunctionRefBase<true, true, R, Args...> {
+public:
+	using impl::function::FunctionRefBase<true, true, R, Args...>::FunctionRefBase;
+};
+
+} // namespace rb::core
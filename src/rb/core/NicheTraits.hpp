@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstring>
+
+#include <rb/core/limits.hpp>
+#include <rb/core/traits/enums.hpp>
+#include <rb/core/traits/Void.hpp>
+#include <rb/core/types.hpp>
+
+namespace rb::core {
+
+/**
+ * NicheTraits describes the bit patterns of the object representation of @p T which never hold a valid value,
+ * so a wrapper may keep its own state in them instead of a separate field (see Option and Variant).
+ *
+ * Specializations provide:
+ * - `static constexpr usize kCount`, the number of niches;
+ * - `static void store(void* storage, usize niche) noexcept`, which writes niche `niche < kCount` into
+ *   `sizeof(T)` bytes at `storage`, where no T object is alive;
+ * - `static usize load(void const* storage) noexcept`, which returns the niche held by `storage`,
+ *   or `kCount` if it holds a valid T.
+ *
+ * If the niches are object representations of T which the members of T may hold (e.g. an unused range of a field),
+ * the specialization also provides these, so the niches are usable in constant expressions:
+ * - `static constexpr T make(usize niche) noexcept`, which returns a T object holding niche `niche`;
+ * - `static constexpr usize index(T const& value) noexcept`, the counterpart of `load`.
+ *
+ * The primary template declares no niches.
+ */
+template <class T, class = void>
+struct NicheTraits {
+	static constexpr usize kCount = 0;
+};
+
+namespace impl {
+
+	template <class T, class = void>
+	inline constexpr bool hasValueNiches = false;
+
+	template <class T>
+	inline constexpr bool hasValueNiches<T, Void<decltype(NicheTraits<T>::index(NicheTraits<T>::make(0)))>> = true;
+
+} // namespace impl
+
+/// Whether the niches of @p T are objects of @p T, see NicheTraits::make().
+template <class T>
+inline constexpr bool hasValueNiches = impl::hasValueNiches<T>;
+
+/// `bool` is a byte which is either 0 or 1, so values `2..255` are free.
+/// They aren't `bool` values though, so they can't be used in constant expressions.
+template <>
+struct NicheTraits<bool> {
+	static_assert(sizeof(bool) == 1);
+
+	static constexpr usize kCount = 254;
+
+	static void store(void* storage, usize niche) noexcept {
+		auto const byte = static_cast<unsigned char>(niche + 2);
+		std::memcpy(storage, &byte, 1);
+	}
+
+	static usize load(void const* storage) noexcept {
+		unsigned char byte = 0;
+		std::memcpy(&byte, storage, 1);
+		return byte >= 2 ? byte - 2 : kCount;
+	}
+};
+
+/**
+ * A base for NicheTraits of an enumeration whose values never exceed @p last:
+ * the values of the underlying type above it are niches.
+ * Since the compiler doesn't know the range of an enumeration, the specialization is opt-in:
+ * @code
+ * template <>
+ * struct rb::core::NicheTraits<Color> : rb::core::EnumNicheTraits<Color, Color::kBlue> {};
+ * @endcode
+ */
+template <class E, E last>
+struct EnumNicheTraits {
+	using Underlying = UnderlyingType<E>;
+
+	static constexpr auto kLast = static_cast<Underlying>(last);
+	static constexpr usize kCount = static_cast<usize>(max<Underlying> - kLast);
+
+	static constexpr E make(usize niche) noexcept {
+		return static_cast<E>(kLast + 1 + static_cast<Underlying>(niche));
+	}
+
+	static constexpr usize index(E value) noexcept {
+		auto const underlying = static_cast<Underlying>(value);
+		return underlying > kLast ? static_cast<usize>(underlying - kLast - 1) : kCount;
+	}
+
+	static void store(void* storage, usize niche) noexcept {
+		E const value = make(niche);
+		std::memcpy(storage, &value, sizeof(value));
+	}
+
+	static usize load(void const* storage) noexcept {
+		E value{};
+		std::memcpy(&value, storage, sizeof(value));
+		return index(value);
+	}
+};
+
+} // namespace rb::core
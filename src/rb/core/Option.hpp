@@ -8,7 +8,10 @@
 #include <rb/core/InPlace.hpp>
 #include <rb/core/invoke.hpp>
 #include <rb/core/memory/addressOf.hpp>
+#include <rb/core/NicheTraits.hpp>
+#include <rb/core/traits/builtins.hpp>
 #include <rb/core/traits/IsScalar.hpp>
+#include <rb/core/traits/IsVoid.hpp>
 #include <rb/core/traits/requirements.hpp>
 #include <rb/core/warnings.hpp>
 
@@ -188,6 +191,10 @@ namespace impl {
 			engaged = true;
 		}
 
+		constexpr bool isEngaged() const noexcept {
+			return engaged;
+		}
+
 		// The get() operations have `engaged` as a precondition.
 		// They exist to access the contained value with the appropriate
 		// const-qualification, because the payload has had the `const` removed.
@@ -314,6 +321,72 @@ namespace impl {
 
 	RB_WARNING_POP
 
+	/// Whether Option<T> keeps the disengaged state in a niche of T instead of a separate flag.
+	/// Only niches which are objects of T are used (see hasValueNiches), so such optionals stay usable in constant expressions.
+	template <class T>
+	inline constexpr bool kUsesNiche = hasValueNiches<RemoveConst<T>> && isTriviallyCopyable<T>;
+
+	/**
+	 * Payload for optionals of trivially copyable types with niches (see NicheTraits):
+	 * the value is always alive, and the disengaged state is the value holding niche 0,
+	 * so the payload is as large as the value.
+	 */
+	template <class T>
+	struct OptionNichePayload {
+		using StoredType = RemoveConst<T>;
+		using Niche = NicheTraits<StoredType>;
+
+		OptionStorage<StoredType> payload;
+
+		constexpr OptionNichePayload() noexcept
+		    : payload{kInPlace, Niche::make(0)} {
+		}
+
+		template <class... Args>
+		constexpr OptionNichePayload(InPlace inPlace, Args&&... args) // NOLINT(google-explicit-constructor)
+		    : payload{inPlace, RB_FWD(args)...} {
+		}
+
+		template <class U, class... Args>
+		constexpr OptionNichePayload(std::initializer_list<U> il, Args&&... args)
+		    : payload{il, RB_FWD(args)...} {
+		}
+
+		constexpr bool isEngaged() const noexcept {
+			return Niche::index(payload.value) == Niche::kCount;
+		}
+
+		template <class... Args>
+		constexpr void construct(Args&&... args) noexcept(isNothrowConstructible<StoredType, Args...>) {
+			::new (addressOf(this->payload.value)) T(RB_FWD(args)...);
+		}
+
+		// the value is trivially destructible
+		constexpr void destroy() noexcept {
+			payload.value = Niche::make(0);
+		}
+
+		template <class F, class U>
+		constexpr void apply(OptionFunc<F> f, U&& arg) {
+			::new (addressOf(this->payload)) OptionStorage<StoredType>{f, RB_FWD(arg)};
+		}
+
+		constexpr T& get() noexcept {
+			return this->payload.value;
+		}
+
+		constexpr T const& get() const noexcept {
+			return this->payload.value;
+		}
+
+		constexpr void resetImpl() noexcept {
+			destroy();
+		}
+	};
+
+	template <class T>
+	using OptionPayloadFor = Conditional<kUsesNiche<T>, OptionNichePayload<T>, OptionPayload<T>>;
+
 	// Common base class for OptionBase<T> to avoid repeating these member functions in each specialization
 	template <class T, class U>
 	class OptionBaseImpl {
@@ -335,7 +408,7 @@ namespace impl {
 		}
 
 		constexpr bool engaged() const noexcept {
-			return static_cast<U const*>(this)->payload.engaged;
+			return static_cast<U const*>(this)->payload.isEngaged();
 		}
 
 		constexpr T& get() noexcept {
@@ -473,7 +546,8 @@ namespace impl {
 		OptionBase& operator=(OptionBase const&) = default;
 		OptionBase& operator=(OptionBase&&) noexcept = default;
 
-		OptionPayload<T> payload;
+		// types with niches are trivially copyable, so only this specialization may use them
+		OptionPayloadFor<T> payload;
 	};
 
 	template <class T, class U>
@@ -927,6 +1001,11 @@ private:
 	}
 };
 
+/**
+ * Option of a reference is a nullable pointer to the referred object, so it's as large as a pointer
+ * and lets lookups return an element without copying it.
+ * Assignment rebinds the reference instead of assigning to the referred object.
+ */
 template <class T>
 class RB_EXPORT Option<T&> final {
 	template <class U>
@@ -946,15 +1025,16 @@ public:
 	    : ptr_{addressOf(value)} {
 	}
 
-	template <class U>
+	template <class U,
+	    RB_REQUIRES_T(And<NotSelf<U>, IsConvertible<U*, T*>>)>
 	constexpr Option(U& value RB_LIFETIME_BOUND) noexcept
-	    : Option{kInPlace, value} {
+	    : ptr_{addressOf(value)} {
 	}
 
 	template <class U,
 	    RB_REQUIRES_T(And<
 	        Not<IsSame<T&, U>>,
-	        IsConvertible<U const*, T*>,
+	        IsConvertible<RemoveRef<U> const*, T*>,
 	        Not<impl::ConvertsFromOption<T&, U>>>)>
 	constexpr Option(Option<U> const& rhs) noexcept {
 		if (rhs) {
@@ -965,7 +1045,7 @@ public:
 	template <class U,
 	    RB_REQUIRES_T(And<
 	        Not<IsSame<T&, U>>,
-	        IsConvertible<U*, T*>,
+	        IsConvertible<RemoveRef<U>*, T*>,
 	        Not<impl::ConvertsFromOption<T&, U>>>)>
 	constexpr Option(Option<U>& rhs) noexcept {
 		if (rhs) {
@@ -995,7 +1075,7 @@ public:
 	    class U,
 	    RB_REQUIRES_T(And<
 	        Not<IsSame<T&, U>>,
-	        IsConvertible<U const*, T*>,
+	        IsConvertible<RemoveRef<U> const*, T*>,
 	        Not<impl::ConvertsFromOption<T&, U>>,
 	        Not<impl::AssignsFromOption<T&, U>>>)>
 	Option& operator=(Option<U> const& rhs) noexcept {
@@ -1011,7 +1091,7 @@ public:
 	    class U,
 	    RB_REQUIRES_T(And<
 	        Not<IsSame<T&, U>>,
-	        IsConvertible<U*, T*>,
+	        IsConvertible<RemoveRef<U>*, T*>,
 	        Not<impl::ConvertsFromOption<T&, U>>,
 	        Not<impl::AssignsFromOption<T&, U>>>)>
 	Option& operator=(Option<U>& rhs) noexcept {
@@ -1222,6 +1302,125 @@ private:
 	T* ptr_ = nullptr;
 };
 
+/**
+ * Option of `void` is the result of an operation which either succeeds without a value or doesn't happen,
+ * so it's just a flag.
+ * `map` and `andThen` call their functions without arguments.
+ */
+template <>
+class RB_EXPORT Option<void> final {
+public:
+	constexpr Option() noexcept = default;
+
+	// NOLINTBEGIN(google-explicit-constructor)
+
+	constexpr Option(NoneOption /*unused*/) noexcept {
+	}
+
+	// NOLINTEND(google-explicit-constructor)
+
+	constexpr explicit Option(InPlace /*unused*/) noexcept
+	    : engaged_{true} {
+	}
+
+	Option& operator=(NoneOption /*unused*/) noexcept {
+		engaged_ = false;
+		return *this;
+	}
+
+	constexpr void emplace() noexcept {
+		engaged_ = true;
+	}
+
+	void swap(Option& rhs) noexcept {
+		core::swap(engaged_, rhs.engaged_);
+	}
+
+	constexpr void operator*() const noexcept {
+		RB_ASSERT(hasValue());
+	}
+
+	constexpr explicit operator bool() const noexcept {
+		return engaged_;
+	}
+
+	constexpr bool hasValue() const noexcept {
+		return engaged_;
+	}
+
+	constexpr void value() const noexcept {
+		RB_ASSERT(hasValue());
+	}
+
+	constexpr void unwrap() const noexcept {
+		value();
+	}
+
+	constexpr void expect(char const* msg) const noexcept {
+		RB_ASSERT_CUSTOM_MSG(msg, hasValue());
+	}
+
+	template <class F>
+	constexpr auto andThen(F&& f) const {
+		using U = RemoveCvRef<InvokeResult<F>>;
+		static_assert(isOption<U>);
+		if (hasValue()) {
+			return invoke(RB_FWD(f));
+		}
+		return U{};
+	}
+
+	template <class F>
+	constexpr auto map(F&& f) const {
+		using U = InvokeResult<F>;
+		if (hasValue()) {
+			if constexpr (isVoid<U>) {
+				return Option<U>{impl::OptionFunc<F>{f}};
+			} else {
+				return Option<U>{invoke(RB_FWD(f))};
+			}
+		}
+		return Option<U>{};
+	}
+
+	template <class F,
+	    RB_REQUIRES(isInvocable<F>)>
+	constexpr Option orElse(F&& f) const {
+		using U = InvokeResult<F>;
+		static_assert(isSame<RemoveCvRef<U>, Option>);
+
+		if (hasValue()) {
+			return *this;
+		}
+		return RB_FWD(f)();
+	}
+
+	constexpr void reset() noexcept {
+		engaged_ = false;
+	}
+
+	friend constexpr bool operator==(Option lhs, Option rhs) noexcept {
+		return lhs.engaged_ == rhs.engaged_;
+	}
+
+	friend constexpr bool operator!=(Option lhs, Option rhs) noexcept {
+		return lhs.engaged_ != rhs.engaged_;
+	}
+
+private:
+	template <class>
+	friend class Option;
+
+	// the result of `map` with a function returning `void`
+	template <class F, class... Args>
+	constexpr explicit Option(impl::OptionFunc<F> f, Args&&... args) noexcept(isNothrowInvocable<F, Args...>)
+	    : engaged_{true} {
+		invoke(RB_FWD(f.func), RB_FWD(args)...);
+	}
+
+	bool engaged_ = false;
+};
+
 // deduction guides
 template <class T>
 Option(T) -> Option<T>;
@@ -1238,7 +1437,7 @@ template <class T, class U, RB_REQUIRES_T(IsInequalityComparable<T const&, U con
 constexpr bool operator!=(Option<T> const& lhs, Option<U> const& rhs) RB_NOEXCEPT_LIKE(*lhs != *rhs) {
 	return lhs
 	    ? !rhs || *lhs != *rhs
-	    : rhs;
+	    : static_cast<bool>(rhs);
 }
 
 // FIXME add other rel ops
@@ -0,0 +1,1301 @@
+#pragma once
+
+#include <cstring>
+
+#include <rb/core/assert.hpp>
+#include <rb/core/limits.hpp>
+#include <rb/core/processor.hpp>
+#include <rb/core/requires.hpp>
+#include <rb/core/Span.hpp>
+#include <rb/core/traits/IsFloatingPoint.hpp>
+#include <rb/core/traits/IsIntegral.hpp>
+#include <rb/core/traits/IsSame.hpp>
+#include <rb/core/traits/IsSigned.hpp>
+#include <rb/core/traits/Signed.hpp>
+#include <rb/core/traits/Unsigned.hpp>
+#include <rb/core/types.hpp>
+
+// The backends are chosen at compile time from the target ISA:
+// SSE2 (with SSE4.1/4.2 instructions when enabled) and AVX2 on x86, NEON on AArch64.
+// Other targets and vector widths use the scalar backend, which compilers are free to auto-vectorize.
+#if defined(RB_PROCESSOR_X86) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RB_SIMD_SSE2 1
+	#include <immintrin.h>
+#else
+	#define RB_SIMD_SSE2 0
+#endif
+
+#if RB_SIMD_SSE2 && defined(__AVX2__)
+	#define RB_SIMD_AVX2 1
+#else
+	#define RB_SIMD_AVX2 0
+#endif
+
+#if defined(RB_PROCESSOR_ARM_64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+	#define RB_SIMD_NEON 1
+	#include <arm_neon.h>
+#else
+	#define RB_SIMD_NEON 0
+#endif
+
+namespace rb::core {
+
+template <class T, usize n>
+class SimdMask;
+
+namespace impl::simd {
+
+	// NOLINTBEGIN(*-reinterpret-cast)
+
+	template <class T>
+	inline constexpr bool isLane = isSame<T, i8> || isSame<T, u8> || isSame<T, i16> || isSame<T, u16>
+	                            || isSame<T, i32> || isSame<T, u32> || isSame<T, i64> || isSame<T, u64>
+	                            || isSame<T, f32> || isSame<T, f64>;
+
+	/// The width of the widest registers of the target.
+	inline constexpr usize kNativeBytes = RB_SIMD_AVX2 ? 32 : 16;
+
+	// integer lanes are computed as unsigned, so the overflow wraps around like in the vector instructions
+	template <class T, bool = isIntegral<T>>
+	struct ArithmeticOf {
+		using Type = decltype(0U + core::Unsigned<T>{});
+	};
+
+	template <class T>
+	struct ArithmeticOf<T, false> {
+		using Type = T;
+	};
+
+	template <class T>
+	using Arithmetic = typename ArithmeticOf<T>::Type;
+
+	template <usize n>
+	inline constexpr u64 kAllLanes = n == 64 ? ~u64{0} : (u64{1} << n) - 1;
+
+	template <class T, usize n>
+	struct Scalar {
+		struct Reg {
+			T lanes[n];
+		};
+
+		struct Mask {
+			bool lanes[n];
+		};
+
+		template <class R, class Op>
+		static R map(R const& a, R const& b, Op op) noexcept {
+			R r;
+			for (usize i = 0; i < n; ++i) {
+				r.lanes[i] = op(a.lanes[i], b.lanes[i]);
+			}
+			return r;
+		}
+
+		template <class Op>
+		static Mask compare(Reg const& a, Reg const& b, Op op) noexcept {
+			Mask r;
+			for (usize i = 0; i < n; ++i) {
+				r.lanes[i] = op(a.lanes[i], b.lanes[i]);
+			}
+			return r;
+		}
+
+		static Reg load(T const* src) noexcept {
+			Reg r;
+			std::memcpy(r.lanes, src, sizeof(r.lanes));
+			return r;
+		}
+
+		static void store(T* dst, Reg const& r) noexcept {
+			std::memcpy(dst, r.lanes, sizeof(r.lanes));
+		}
+
+		static Reg broadcast(T value) noexcept {
+			Reg r;
+			for (auto& lane : r.lanes) {
+				lane = value;
+			}
+			return r;
+		}
+
+		static T addLanes(T x, T y) noexcept {
+			return static_cast<T>(static_cast<Arithmetic<T>>(x) + static_cast<Arithmetic<T>>(y));
+		}
+
+		static T minLanes(T x, T y) noexcept {
+			return x < y ? x : y;
+		}
+
+		static T maxLanes(T x, T y) noexcept {
+			return y < x ? x : y;
+		}
+
+		static Reg add(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, &addLanes);
+		}
+
+		static Reg sub(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, [](T x, T y) {
+				return static_cast<T>(static_cast<Arithmetic<T>>(x) - static_cast<Arithmetic<T>>(y));
+			});
+		}
+
+		static Reg mul(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, [](T x, T y) {
+				return static_cast<T>(static_cast<Arithmetic<T>>(x) * static_cast<Arithmetic<T>>(y));
+			});
+		}
+
+		static Reg div(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, [](T x, T y) { return x / y; });
+		}
+
+		static Reg neg(Reg const& a) noexcept {
+			return map(a, a, [](T x, T /*unused*/) { return -x; });
+		}
+
+		static Reg bitAnd(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, [](T x, T y) { return static_cast<T>(x & y); });
+		}
+
+		static Reg bitOr(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, [](T x, T y) { return static_cast<T>(x | y); });
+		}
+
+		static Reg bitXor(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, [](T x, T y) { return static_cast<T>(x ^ y); });
+		}
+
+		static Mask eq(Reg const& a, Reg const& b) noexcept {
+			return compare(a, b, [](T x, T y) { return x == y; });
+		}
+
+		static Mask lt(Reg const& a, Reg const& b) noexcept {
+			return compare(a, b, [](T x, T y) { return x < y; });
+		}
+
+		static Mask le(Reg const& a, Reg const& b) noexcept {
+			return compare(a, b, [](T x, T y) { return x <= y; });
+		}
+
+		static Reg min(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, &minLanes);
+		}
+
+		static Reg max(Reg const& a, Reg const& b) noexcept {
+			return map(a, b, &maxLanes);
+		}
+
+		static Reg select(Mask const& m, Reg const& a, Reg const& b) noexcept {
+			Reg r;
+			for (usize i = 0; i < n; ++i) {
+				r.lanes[i] = m.lanes[i] ? a.lanes[i] : b.lanes[i];
+			}
+			return r;
+		}
+
+		static Mask maskAnd(Mask const& a, Mask const& b) noexcept {
+			return map(a, b, [](bool x, bool y) { return x && y; });
+		}
+
+		static Mask maskOr(Mask const& a, Mask const& b) noexcept {
+			return map(a, b, [](bool x, bool y) { return x || y; });
+		}
+
+		static Mask maskXor(Mask const& a, Mask const& b) noexcept {
+			return map(a, b, [](bool x, bool y) { return x != y; });
+		}
+
+		static Mask maskNot(Mask const& m) noexcept {
+			return map(m, m, [](bool x, bool /*unused*/) { return !x; });
+		}
+
+		static u64 movemask(Mask const& m) noexcept {
+			u64 bits = 0;
+			for (usize i = 0; i < n; ++i) {
+				bits |= u64{m.lanes[i]} << i;
+			}
+			return bits;
+		}
+
+		template <class Op>
+		static T reduce(Reg const& r, Op op) noexcept {
+			T acc = r.lanes[0];
+			for (usize i = 1; i < n; ++i) {
+				acc = op(acc, r.lanes[i]);
+			}
+			return acc;
+		}
+
+		static T reduceAdd(Reg const& r) noexcept {
+			return reduce(r, &addLanes);
+		}
+
+		static T reduceMin(Reg const& r) noexcept {
+			return reduce(r, &minLanes);
+		}
+
+		static T reduceMax(Reg const& r) noexcept {
+			return reduce(r, &maxLanes);
+		}
+	};
+
+#if RB_SIMD_SSE2
+
+	template <class T>
+	struct SseReg {
+		using Type = __m128i;
+	};
+
+	template <>
+	struct SseReg<f32> {
+		using Type = __m128;
+	};
+
+	template <>
+	struct SseReg<f64> {
+		using Type = __m128d;
+	};
+
+	/// Floating-point lanes are handled in their own domain only for arithmetic and comparisons,
+	/// everything else treats the register as a bunch of bits.
+	template <class T>
+	struct Sse {
+		using Reg = typename SseReg<T>::Type;
+		using Mask = Reg;
+
+		static constexpr bool kF32 = isSame<T, f32>;
+		static constexpr bool kF64 = isSame<T, f64>;
+
+		static __m128i bits(Reg r) noexcept {
+			if constexpr (kF32) {
+				return _mm_castps_si128(r);
+			} else if constexpr (kF64) {
+				return _mm_castpd_si128(r);
+			} else {
+				return r;
+			}
+		}
+
+		static Reg fromBits(__m128i r) noexcept {
+			if constexpr (kF32) {
+				return _mm_castsi128_ps(r);
+			} else if constexpr (kF64) {
+				return _mm_castsi128_pd(r);
+			} else {
+				return r;
+			}
+		}
+
+		static Reg load(T const* src) noexcept {
+			return fromBits(_mm_loadu_si128(reinterpret_cast<__m128i const*>(src)));
+		}
+
+		static void store(T* dst, Reg r) noexcept {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bits(r));
+		}
+
+		static Reg broadcast(T value) noexcept {
+			if constexpr (kF32) {
+				return _mm_set1_ps(value);
+			} else if constexpr (kF64) {
+				return _mm_set1_pd(value);
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm_set1_epi8(static_cast<char>(value));
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm_set1_epi16(static_cast<short>(value));
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm_set1_epi32(static_cast<int>(value));
+			} else {
+				return _mm_set1_epi64x(static_cast<long long>(value));
+			}
+		}
+
+		static Reg add(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_add_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm_add_pd(a, b);
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm_add_epi8(a, b);
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm_add_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm_add_epi32(a, b);
+			} else {
+				return _mm_add_epi64(a, b);
+			}
+		}
+
+		static Reg sub(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_sub_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm_sub_pd(a, b);
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm_sub_epi8(a, b);
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm_sub_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm_sub_epi32(a, b);
+			} else {
+				return _mm_sub_epi64(a, b);
+			}
+		}
+
+		static Reg mul(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_mul_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm_mul_pd(a, b);
+			} else if constexpr (sizeof(T) == 1) {
+				// multiply the even and the odd bytes as 16-bit words and keep the low bytes of the products
+				__m128i const even = _mm_mullo_epi16(a, b);
+				__m128i const odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+				return _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xff)));
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm_mullo_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+	#ifdef __SSE4_1__
+				return _mm_mullo_epi32(a, b);
+	#else
+				__m128i const even = _mm_mul_epu32(a, b);
+				__m128i const odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+				return _mm_unpacklo_epi32(
+				    _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+	#endif
+			} else {
+				// the high halves of the products of the high halves are shifted out anyway
+				__m128i const lo = _mm_mul_epu32(a, b);
+				__m128i const cross = _mm_add_epi64(
+				    _mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+				return _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+			}
+		}
+
+		static Reg div(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_div_ps(a, b);
+			} else {
+				return _mm_div_pd(a, b);
+			}
+		}
+
+		static Reg neg(Reg a) noexcept {
+			if constexpr (kF32) {
+				return _mm_xor_ps(a, _mm_set1_ps(-0.0F));
+			} else {
+				return _mm_xor_pd(a, _mm_set1_pd(-0.0));
+			}
+		}
+
+		static Reg bitAnd(Reg a, Reg b) noexcept {
+			return fromBits(_mm_and_si128(bits(a), bits(b)));
+		}
+
+		static Reg bitOr(Reg a, Reg b) noexcept {
+			return fromBits(_mm_or_si128(bits(a), bits(b)));
+		}
+
+		static Reg bitXor(Reg a, Reg b) noexcept {
+			return fromBits(_mm_xor_si128(bits(a), bits(b)));
+		}
+
+		static Mask eq(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_cmpeq_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm_cmpeq_pd(a, b);
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm_cmpeq_epi8(a, b);
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm_cmpeq_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm_cmpeq_epi32(a, b);
+			} else {
+	#ifdef __SSE4_1__
+				return _mm_cmpeq_epi64(a, b);
+	#else
+				__m128i const halves = _mm_cmpeq_epi32(a, b);
+				return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+	#endif
+			}
+		}
+
+		/// Signed `a > b` for 64-bit lanes.
+		static __m128i greater64(__m128i a, __m128i b) noexcept {
+	#ifdef __SSE4_2__
+			return _mm_cmpgt_epi64(a, b);
+	#else
+			// the high halves are compared as signed, and the low ones as unsigned if the high ones are equal
+			__m128i const hiGreater = _mm_cmpgt_epi32(a, b);
+			__m128i const hiEqual = _mm_cmpeq_epi32(a, b);
+			__m128i const flip = _mm_set1_epi32(static_cast<int>(0x8000'0000U));
+			__m128i const loGreater = _mm_cmpgt_epi32(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+			__m128i const greater = _mm_or_si128(
+			    hiGreater, _mm_and_si128(hiEqual, _mm_shuffle_epi32(loGreater, _MM_SHUFFLE(2, 2, 0, 0))));
+			return _mm_shuffle_epi32(greater, _MM_SHUFFLE(3, 3, 1, 1));
+	#endif
+		}
+
+		static Mask lt(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_cmplt_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm_cmplt_pd(a, b);
+			} else if constexpr (!isSigned<T>) {
+				// flipping the sign bits maps the unsigned order onto the signed one
+				Reg const flip = Sse<SignedType<T>>::broadcast(core::min<SignedType<T>>);
+				return Sse<SignedType<T>>::lt(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm_cmplt_epi8(a, b);
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm_cmplt_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm_cmplt_epi32(a, b);
+			} else {
+				return greater64(b, a);
+			}
+		}
+
+		static Mask le(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_cmple_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm_cmple_pd(a, b);
+			} else {
+				return maskNot(lt(b, a));
+			}
+		}
+
+		static Reg select(Mask m, Reg a, Reg b) noexcept {
+	#ifdef __SSE4_1__
+			return fromBits(_mm_blendv_epi8(bits(b), bits(a), bits(m)));
+	#else
+			return fromBits(_mm_or_si128(_mm_and_si128(bits(m), bits(a)), _mm_andnot_si128(bits(m), bits(b))));
+	#endif
+		}
+
+		static Reg min(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_min_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm_min_pd(a, b);
+			} else if constexpr (isSame<T, u8>) {
+				return _mm_min_epu8(a, b);
+			} else if constexpr (isSame<T, i16>) {
+				return _mm_min_epi16(a, b);
+	#ifdef __SSE4_1__
+			} else if constexpr (isSame<T, i8>) {
+				return _mm_min_epi8(a, b);
+			} else if constexpr (isSame<T, u16>) {
+				return _mm_min_epu16(a, b);
+			} else if constexpr (isSame<T, i32>) {
+				return _mm_min_epi32(a, b);
+			} else if constexpr (isSame<T, u32>) {
+				return _mm_min_epu32(a, b);
+	#endif
+			} else {
+				return select(lt(a, b), a, b);
+			}
+		}
+
+		static Reg max(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm_max_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm_max_pd(a, b);
+			} else if constexpr (isSame<T, u8>) {
+				return _mm_max_epu8(a, b);
+			} else if constexpr (isSame<T, i16>) {
+				return _mm_max_epi16(a, b);
+	#ifdef __SSE4_1__
+			} else if constexpr (isSame<T, i8>) {
+				return _mm_max_epi8(a, b);
+			} else if constexpr (isSame<T, u16>) {
+				return _mm_max_epu16(a, b);
+			} else if constexpr (isSame<T, i32>) {
+				return _mm_max_epi32(a, b);
+			} else if constexpr (isSame<T, u32>) {
+				return _mm_max_epu32(a, b);
+	#endif
+			} else {
+				return select(lt(b, a), a, b);
+			}
+		}
+
+		static Mask maskAnd(Mask a, Mask b) noexcept {
+			return bitAnd(a, b);
+		}
+
+		static Mask maskOr(Mask a, Mask b) noexcept {
+			return bitOr(a, b);
+		}
+
+		static Mask maskXor(Mask a, Mask b) noexcept {
+			return bitXor(a, b);
+		}
+
+		static Mask maskNot(Mask m) noexcept {
+			return fromBits(_mm_xor_si128(bits(m), _mm_set1_epi32(-1)));
+		}
+
+		static u64 movemask(Mask m) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				return static_cast<u32>(_mm_movemask_epi8(m));
+			} else if constexpr (sizeof(T) == 2) {
+				// the lanes are either 0 or -1, so the signed saturation keeps them
+				return static_cast<u32>(_mm_movemask_epi8(_mm_packs_epi16(bits(m), _mm_setzero_si128())));
+			} else if constexpr (sizeof(T) == 4) {
+				return static_cast<u32>(_mm_movemask_ps(_mm_castsi128_ps(bits(m))));
+			} else {
+				return static_cast<u32>(_mm_movemask_pd(_mm_castsi128_pd(bits(m))));
+			}
+		}
+
+		static T first(Reg r) noexcept {
+			T value;
+			std::memcpy(&value, &r, sizeof(T));
+			return value;
+		}
+
+		/// Folds the upper half of the lanes onto the lower one until the first lane holds the result;
+		/// the zeroes shifted in only reach the lanes which are dropped afterwards.
+		template <int shift = 8, class Op>
+		static T reduce(Reg r, Op op) noexcept {
+			if constexpr (shift < static_cast<int>(sizeof(T))) {
+				return first(r);
+			} else {
+				return reduce<shift / 2>(op(r, fromBits(_mm_srli_si128(bits(r), shift))), op);
+			}
+		}
+
+		static T reduceAdd(Reg r) noexcept {
+			return reduce(r, [](Reg a, Reg b) { return add(a, b); });
+		}
+
+		static T reduceMin(Reg r) noexcept {
+			return reduce(r, [](Reg a, Reg b) { return min(a, b); });
+		}
+
+		static T reduceMax(Reg r) noexcept {
+			return reduce(r, [](Reg a, Reg b) { return max(a, b); });
+		}
+	};
+
+#endif
+
+#if RB_SIMD_AVX2
+
+	template <class T>
+	struct AvxReg {
+		using Type = __m256i;
+	};
+
+	template <>
+	struct AvxReg<f32> {
+		using Type = __m256;
+	};
+
+	template <>
+	struct AvxReg<f64> {
+		using Type = __m256d;
+	};
+
+	template <class T>
+	struct Avx2 {
+		using Reg = typename AvxReg<T>::Type;
+		using Mask = Reg;
+		using Half = Sse<T>;
+
+		static constexpr bool kF32 = isSame<T, f32>;
+		static constexpr bool kF64 = isSame<T, f64>;
+
+		static __m256i bits(Reg r) noexcept {
+			if constexpr (kF32) {
+				return _mm256_castps_si256(r);
+			} else if constexpr (kF64) {
+				return _mm256_castpd_si256(r);
+			} else {
+				return r;
+			}
+		}
+
+		static Reg fromBits(__m256i r) noexcept {
+			if constexpr (kF32) {
+				return _mm256_castsi256_ps(r);
+			} else if constexpr (kF64) {
+				return _mm256_castsi256_pd(r);
+			} else {
+				return r;
+			}
+		}
+
+		static Reg load(T const* src) noexcept {
+			return fromBits(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(src)));
+		}
+
+		static void store(T* dst, Reg r) noexcept {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), bits(r));
+		}
+
+		static Reg broadcast(T value) noexcept {
+			if constexpr (kF32) {
+				return _mm256_set1_ps(value);
+			} else if constexpr (kF64) {
+				return _mm256_set1_pd(value);
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm256_set1_epi8(static_cast<char>(value));
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm256_set1_epi16(static_cast<short>(value));
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm256_set1_epi32(static_cast<int>(value));
+			} else {
+				return _mm256_set1_epi64x(static_cast<long long>(value));
+			}
+		}
+
+		static Reg add(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_add_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm256_add_pd(a, b);
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm256_add_epi8(a, b);
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm256_add_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm256_add_epi32(a, b);
+			} else {
+				return _mm256_add_epi64(a, b);
+			}
+		}
+
+		static Reg sub(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_sub_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm256_sub_pd(a, b);
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm256_sub_epi8(a, b);
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm256_sub_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm256_sub_epi32(a, b);
+			} else {
+				return _mm256_sub_epi64(a, b);
+			}
+		}
+
+		static Reg mul(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_mul_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm256_mul_pd(a, b);
+			} else if constexpr (sizeof(T) == 1) {
+				__m256i const even = _mm256_mullo_epi16(a, b);
+				__m256i const odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+				return _mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xff)));
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm256_mullo_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm256_mullo_epi32(a, b);
+			} else {
+				__m256i const lo = _mm256_mul_epu32(a, b);
+				__m256i const cross = _mm256_add_epi64(
+				    _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+				return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+			}
+		}
+
+		static Reg div(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_div_ps(a, b);
+			} else {
+				return _mm256_div_pd(a, b);
+			}
+		}
+
+		static Reg neg(Reg a) noexcept {
+			if constexpr (kF32) {
+				return _mm256_xor_ps(a, _mm256_set1_ps(-0.0F));
+			} else {
+				return _mm256_xor_pd(a, _mm256_set1_pd(-0.0));
+			}
+		}
+
+		static Reg bitAnd(Reg a, Reg b) noexcept {
+			return fromBits(_mm256_and_si256(bits(a), bits(b)));
+		}
+
+		static Reg bitOr(Reg a, Reg b) noexcept {
+			return fromBits(_mm256_or_si256(bits(a), bits(b)));
+		}
+
+		static Reg bitXor(Reg a, Reg b) noexcept {
+			return fromBits(_mm256_xor_si256(bits(a), bits(b)));
+		}
+
+		static Mask eq(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+			} else if constexpr (kF64) {
+				return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm256_cmpeq_epi8(a, b);
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm256_cmpeq_epi16(a, b);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm256_cmpeq_epi32(a, b);
+			} else {
+				return _mm256_cmpeq_epi64(a, b);
+			}
+		}
+
+		static Mask lt(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+			} else if constexpr (kF64) {
+				return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+			} else if constexpr (!isSigned<T>) {
+				Reg const flip = Avx2<SignedType<T>>::broadcast(core::min<SignedType<T>>);
+				return Avx2<SignedType<T>>::lt(_mm256_xor_si256(a, flip), _mm256_xor_si256(b, flip));
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm256_cmpgt_epi8(b, a);
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm256_cmpgt_epi16(b, a);
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm256_cmpgt_epi32(b, a);
+			} else {
+				return _mm256_cmpgt_epi64(b, a);
+			}
+		}
+
+		static Mask le(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+			} else if constexpr (kF64) {
+				return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+			} else {
+				return maskNot(lt(b, a));
+			}
+		}
+
+		static Reg select(Mask m, Reg a, Reg b) noexcept {
+			return fromBits(_mm256_blendv_epi8(bits(b), bits(a), bits(m)));
+		}
+
+		static Reg min(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_min_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm256_min_pd(a, b);
+			} else if constexpr (isSame<T, i8>) {
+				return _mm256_min_epi8(a, b);
+			} else if constexpr (isSame<T, u8>) {
+				return _mm256_min_epu8(a, b);
+			} else if constexpr (isSame<T, i16>) {
+				return _mm256_min_epi16(a, b);
+			} else if constexpr (isSame<T, u16>) {
+				return _mm256_min_epu16(a, b);
+			} else if constexpr (isSame<T, i32>) {
+				return _mm256_min_epi32(a, b);
+			} else if constexpr (isSame<T, u32>) {
+				return _mm256_min_epu32(a, b);
+			} else {
+				return select(lt(a, b), a, b);
+			}
+		}
+
+		static Reg max(Reg a, Reg b) noexcept {
+			if constexpr (kF32) {
+				return _mm256_max_ps(a, b);
+			} else if constexpr (kF64) {
+				return _mm256_max_pd(a, b);
+			} else if constexpr (isSame<T, i8>) {
+				return _mm256_max_epi8(a, b);
+			} else if constexpr (isSame<T, u8>) {
+				return _mm256_max_epu8(a, b);
+			} else if constexpr (isSame<T, i16>) {
+				return _mm256_max_epi16(a, b);
+			} else if constexpr (isSame<T, u16>) {
+				return _mm256_max_epu16(a, b);
+			} else if constexpr (isSame<T, i32>) {
+				return _mm256_max_epi32(a, b);
+			} else if constexpr (isSame<T, u32>) {
+				return _mm256_max_epu32(a, b);
+			} else {
+				return select(lt(b, a), a, b);
+			}
+		}
+
+		static Mask maskAnd(Mask a, Mask b) noexcept {
+			return bitAnd(a, b);
+		}
+
+		static Mask maskOr(Mask a, Mask b) noexcept {
+			return bitOr(a, b);
+		}
+
+		static Mask maskXor(Mask a, Mask b) noexcept {
+			return bitXor(a, b);
+		}
+
+		static Mask maskNot(Mask m) noexcept {
+			return fromBits(_mm256_xor_si256(bits(m), _mm256_set1_epi32(-1)));
+		}
+
+		static u64 movemask(Mask m) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				return static_cast<u32>(_mm256_movemask_epi8(m));
+			} else if constexpr (sizeof(T) == 2) {
+				// the pack works within 128-bit lanes, so the packed halves are gathered into the low lane
+				__m256i const packed = _mm256_packs_epi16(bits(m), _mm256_setzero_si256());
+				return static_cast<u32>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0))));
+			} else if constexpr (sizeof(T) == 4) {
+				return static_cast<u32>(_mm256_movemask_ps(_mm256_castsi256_ps(bits(m))));
+			} else {
+				return static_cast<u32>(_mm256_movemask_pd(_mm256_castsi256_pd(bits(m))));
+			}
+		}
+
+		template <class Op>
+		static T reduce(Reg r, Op op) noexcept {
+			__m256i const all = bits(r);
+			auto const lo = Half::fromBits(_mm256_castsi256_si128(all));
+			auto const hi = Half::fromBits(_mm256_extracti128_si256(all, 1));
+			return Half::reduce(op(lo, hi), op);
+		}
+
+		static T reduceAdd(Reg r) noexcept {
+			return reduce(r, [](auto a, auto b) { return Half::add(a, b); });
+		}
+
+		static T reduceMin(Reg r) noexcept {
+			return reduce(r, [](auto a, auto b) { return Half::min(a, b); });
+		}
+
+		static T reduceMax(Reg r) noexcept {
+			return reduce(r, [](auto a, auto b) { return Half::max(a, b); });
+		}
+	};
+
+#endif
+
+#if RB_SIMD_NEON
+
+	inline u64 movemask(uint8x16_t m) noexcept {
+		static constexpr u8 kWeights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+		uint8x16_t const bits = vandq_u8(m, vld1q_u8(kWeights));
+		return vaddv_u8(vget_low_u8(bits)) | (u64{vaddv_u8(vget_high_u8(bits))} << 8);
+	}
+
+	inline u64 movemask(uint16x8_t m) noexcept {
+		static constexpr u16 kWeights[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+		return vaddvq_u16(vandq_u16(m, vld1q_u16(kWeights)));
+	}
+
+	inline u64 movemask(uint32x4_t m) noexcept {
+		static constexpr u32 kWeights[4] = {1, 2, 4, 8};
+		return vaddvq_u32(vandq_u32(m, vld1q_u32(kWeights)));
+	}
+
+	inline u64 movemask(uint64x2_t m) noexcept {
+		static constexpr u64 kWeights[2] = {1, 2};
+		return vaddvq_u64(vandq_u64(m, vld1q_u64(kWeights)));
+	}
+
+	template <class T>
+	struct Neon;
+
+	// The operations which exist for every lane type; `s` is the suffix of the lane type, `m` the one of the mask.
+	#define RB_SIMD_NEON_COMMON(T, RegType, MaskType, s, m, maskOnes)                                         \
+		using Reg = RegType;                                                                                   \
+		using Mask = MaskType;                                                                                 \
+		static Reg load(T const* src) noexcept { return vld1q_##s(src); }                                      \
+		static void store(T* dst, Reg r) noexcept { vst1q_##s(dst, r); }                                       \
+		static Reg broadcast(T value) noexcept { return vdupq_n_##s(value); }                                  \
+		static Reg add(Reg a, Reg b) noexcept { return vaddq_##s(a, b); }                                      \
+		static Reg sub(Reg a, Reg b) noexcept { return vsubq_##s(a, b); }                                      \
+		static Mask eq(Reg a, Reg b) noexcept { return vceqq_##s(a, b); }                                      \
+		static Mask lt(Reg a, Reg b) noexcept { return vcltq_##s(a, b); }                                      \
+		static Mask le(Reg a, Reg b) noexcept { return vcleq_##s(a, b); }                                      \
+		static Reg select(Mask mask, Reg a, Reg b) noexcept { return vbslq_##s(mask, a, b); }                  \
+		static Mask maskAnd(Mask a, Mask b) noexcept { return vandq_##m(a, b); }                               \
+		static Mask maskOr(Mask a, Mask b) noexcept { return vorrq_##m(a, b); }                                \
+		static Mask maskXor(Mask a, Mask b) noexcept { return veorq_##m(a, b); }                               \
+		static Mask maskNot(Mask mask) noexcept { return veorq_##m(mask, vdupq_n_##m(maskOnes)); }             \
+		static u64 movemask(Mask mask) noexcept { return impl::simd::movemask(mask); }                         \
+		static T reduceAdd(Reg r) noexcept { return vaddvq_##s(r); }
+
+	// folds the upper half of the lanes onto the lower one like the SSE backend does, so NaN lanes win the same way
+	template <class Op>
+	f32 fold(float32x4_t r, Op op) noexcept {
+		r = op(r, vextq_f32(r, r, 2));
+		return vgetq_lane_f32(op(r, vextq_f32(r, r, 1)), 0);
+	}
+
+	template <class Op>
+	f64 fold(float64x2_t r, Op op) noexcept {
+		return vgetq_lane_f64(op(r, vextq_f64(r, r, 1)), 0);
+	}
+
+	// multiplication, minimum and maximum of integers, which don't exist for 64-bit lanes
+	#define RB_SIMD_NEON_MUL_MIN_MAX(s)                                                 \
+		static Reg mul(Reg a, Reg b) noexcept { return vmulq_##s(a, b); }               \
+		static Reg min(Reg a, Reg b) noexcept { return vminq_##s(a, b); }               \
+		static Reg max(Reg a, Reg b) noexcept { return vmaxq_##s(a, b); }               \
+		static auto reduceMin(Reg r) noexcept { return vminvq_##s(r); }                 \
+		static auto reduceMax(Reg r) noexcept { return vmaxvq_##s(r); }
+
+	#define RB_SIMD_NEON_BITWISE(s)                                                     \
+		static Reg bitAnd(Reg a, Reg b) noexcept { return vandq_##s(a, b); }            \
+		static Reg bitOr(Reg a, Reg b) noexcept { return vorrq_##s(a, b); }             \
+		static Reg bitXor(Reg a, Reg b) noexcept { return veorq_##s(a, b); }
+
+	#define RB_SIMD_NEON_INT(T, RegType, MaskType, s, m, maskOnes)   \
+		template <>                                                  \
+		struct Neon<T> {                                             \
+			RB_SIMD_NEON_COMMON(T, RegType, MaskType, s, m, maskOnes) \
+			RB_SIMD_NEON_MUL_MIN_MAX(s)                              \
+			RB_SIMD_NEON_BITWISE(s)                                  \
+		};
+
+	#define RB_SIMD_NEON_INT64(T, RegType, s)                                                     \
+		template <>                                                                               \
+		struct Neon<T> {                                                                          \
+			RB_SIMD_NEON_COMMON(T, RegType, uint64x2_t, s, u64, ~u64{0})                          \
+			RB_SIMD_NEON_BITWISE(s)                                                               \
+			static Reg mul(Reg a, Reg b) noexcept {                                               \
+				T const lanes[2] = {                                                              \
+				    static_cast<T>(u64(vgetq_lane_##s(a, 0)) * u64(vgetq_lane_##s(b, 0))),        \
+				    static_cast<T>(u64(vgetq_lane_##s(a, 1)) * u64(vgetq_lane_##s(b, 1)))};       \
+				return vld1q_##s(lanes);                                                          \
+			}                                                                                     \
+			static Reg min(Reg a, Reg b) noexcept { return select(lt(a, b), a, b); }              \
+			static Reg max(Reg a, Reg b) noexcept { return select(lt(b, a), a, b); }              \
+			static T reduceMin(Reg r) noexcept { return vgetq_lane_##s(min(r, vextq_##s(r, r, 1)), 0); } \
+			static T reduceMax(Reg r) noexcept { return vgetq_lane_##s(max(r, vextq_##s(r, r, 1)), 0); } \
+		};
+
+	// `vminq` and `vmaxq` propagate NaN, so minimum and maximum are selected like `minps` and `maxps` do
+	#define RB_SIMD_NEON_FLOAT(T, RegType, MaskType, s, m, maskOnes)                                           \
+		template <>                                                                                            \
+		struct Neon<T> {                                                                                       \
+			RB_SIMD_NEON_COMMON(T, RegType, MaskType, s, m, maskOnes)                                           \
+			static Reg mul(Reg a, Reg b) noexcept { return vmulq_##s(a, b); }                                  \
+			static Reg div(Reg a, Reg b) noexcept { return vdivq_##s(a, b); }                                  \
+			static Reg neg(Reg a) noexcept { return vnegq_##s(a); }                                            \
+			static Reg min(Reg a, Reg b) noexcept { return select(lt(a, b), a, b); }                           \
+			static Reg max(Reg a, Reg b) noexcept { return select(lt(b, a), a, b); }                           \
+			static T reduceMin(Reg r) noexcept { return fold(r, [](Reg a, Reg b) { return min(a, b); }); }     \
+			static T reduceMax(Reg r) noexcept { return fold(r, [](Reg a, Reg b) { return max(a, b); }); }     \
+		};
+
+	RB_SIMD_NEON_INT(i8, int8x16_t, uint8x16_t, s8, u8, u8{0xff})
+	RB_SIMD_NEON_INT(u8, uint8x16_t, uint8x16_t, u8, u8, u8{0xff})
+	RB_SIMD_NEON_INT(i16, int16x8_t, uint16x8_t, s16, u16, u16{0xffff})
+	RB_SIMD_NEON_INT(u16, uint16x8_t, uint16x8_t, u16, u16, u16{0xffff})
+	RB_SIMD_NEON_INT(i32, int32x4_t, uint32x4_t, s32, u32, ~u32{0})
+	RB_SIMD_NEON_INT(u32, uint32x4_t, uint32x4_t, u32, u32, ~u32{0})
+	RB_SIMD_NEON_INT64(i64, int64x2_t, s64)
+	RB_SIMD_NEON_INT64(u64, uint64x2_t, u64)
+	RB_SIMD_NEON_FLOAT(f32, float32x4_t, uint32x4_t, f32, u32, ~u32{0})
+	RB_SIMD_NEON_FLOAT(f64, float64x2_t, uint64x2_t, f64, u64, ~u64{0})
+
+	#undef RB_SIMD_NEON_FLOAT
+	#undef RB_SIMD_NEON_INT64
+	#undef RB_SIMD_NEON_INT
+	#undef RB_SIMD_NEON_BITWISE
+	#undef RB_SIMD_NEON_MUL_MIN_MAX
+	#undef RB_SIMD_NEON_COMMON
+
+#endif
+
+	// NOLINTEND(*-reinterpret-cast)
+
+	template <class T, usize n, class = void>
+	struct BackendOf {
+		using Type = Scalar<T, n>;
+	};
+
+#if RB_SIMD_SSE2
+	template <class T, usize n>
+	struct BackendOf<T, n, EnableIf<n * sizeof(T) == 16>> {
+		using Type = Sse<T>;
+	};
+#endif
+
+#if RB_SIMD_AVX2
+	template <class T, usize n>
+	struct BackendOf<T, n, EnableIf<n * sizeof(T) == 32>> {
+		using Type = Avx2<T>;
+	};
+#endif
+
+#if RB_SIMD_NEON
+	template <class T, usize n>
+	struct BackendOf<T, n, EnableIf<n * sizeof(T) == 16>> {
+		using Type = Neon<T>;
+	};
+#endif
+
+	template <class T, usize n>
+	using Backend = typename BackendOf<T, n>::Type;
+
+} // namespace impl::simd
+
+/// The number of lanes of type @p T in the widest vector registers of the target.
+template <class T>
+inline constexpr usize kSimdLanes = impl::simd::kNativeBytes / sizeof(T);
+
+/**
+ * Simd is a fixed-size vector of @p n lanes of the arithmetic type @p T,
+ * which maps to SSE2/SSE4/AVX2 or NEON registers when `n * sizeof(T)` matches their width,
+ * and to plain arrays otherwise.
+ *
+ * Integer arithmetic wraps around, comparisons produce SimdMask, and minimum() and maximum() of floating-point lanes
+ * return the second argument if either of the arguments is NaN, like `minps` does.
+ * Since the backend is chosen at compile time, kernels compiled for wider registers with RB_TARGET
+ * should be put in separate translation units built with the corresponding flags.
+ */
+template <class T, usize n = kSimdLanes<T>>
+class Simd {
+	static_assert(impl::simd::isLane<T>, "T must be a fixed-width integer or floating-point type");
+	static_assert(n > 0 && n <= 64, "the lanes must fit into SimdMask::movemask()");
+
+	using Backend = impl::simd::Backend<T, n>;
+	using Reg = typename Backend::Reg;
+
+public:
+	using Value = T;
+	using Mask = SimdMask<T, n>;
+
+	/// Constructs a vector with all lanes set to zero.
+	Simd() noexcept
+	    : reg_(Backend::broadcast(T{})) {
+	}
+
+	/// Constructs a vector with all lanes set to @p value.
+	// ReSharper disable once CppNonExplicitConvertingConstructor
+	Simd(T value) noexcept // NOLINT(*-explicit-constructor)
+	    : reg_(Backend::broadcast(value)) {
+	}
+
+	static constexpr usize size() noexcept {
+		return n;
+	}
+
+	/// Loads the first size() elements of @p src, which doesn't have to be aligned.
+	static Simd load(Span<T const> src) noexcept {
+		RB_ASSERT(src.size() >= n);
+		return Simd{Backend::load(src.data())};
+	}
+
+	/// Stores the lanes to the first size() elements of @p dst, which doesn't have to be aligned.
+	void store(Span<T> dst) const noexcept {
+		RB_ASSERT(dst.size() >= n);
+		Backend::store(dst.data(), reg_);
+	}
+
+	T operator[](usize i) const noexcept {
+		RB_ASSERT(i < n);
+		T lanes[n];
+		Backend::store(lanes, reg_);
+		return lanes[i];
+	}
+
+	/// @return the sum of the lanes; integer lanes wrap around.
+	T reduceAdd() const noexcept {
+		return static_cast<T>(Backend::reduceAdd(reg_));
+	}
+
+	/// @return the smallest lane; which lane wins over NaN lanes depends on the order of the backend's reduction.
+	T reduceMin() const noexcept {
+		return static_cast<T>(Backend::reduceMin(reg_));
+	}
+
+	/// @return the largest lane, with the same caveat for NaN lanes as reduceMin().
+	T reduceMax() const noexcept {
+		return static_cast<T>(Backend::reduceMax(reg_));
+	}
+
+	Simd& operator+=(Simd rhs) noexcept {
+		return *this = *this + rhs;
+	}
+
+	Simd& operator-=(Simd rhs) noexcept {
+		return *this = *this - rhs;
+	}
+
+	Simd& operator*=(Simd rhs) noexcept {
+		return *this = *this * rhs;
+	}
+
+	friend Simd operator+(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::add(lhs.reg_, rhs.reg_)};
+	}
+
+	friend Simd operator-(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::sub(lhs.reg_, rhs.reg_)};
+	}
+
+	/// Negates the lanes; the sign of floating-point lanes is flipped, so `-Simd{0.0}` has negative zeroes.
+	friend Simd operator-(Simd value) noexcept {
+		if constexpr (isFloatingPoint<T>) {
+			return Simd{Backend::neg(value.reg_)};
+		} else {
+			return Simd{} - value;
+		}
+	}
+
+	friend Simd operator*(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::mul(lhs.reg_, rhs.reg_)};
+	}
+
+	template <bool _ = true,
+	    RB_REQUIRES(_&& isFloatingPoint<T>)>
+	friend Simd operator/(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::div(lhs.reg_, rhs.reg_)};
+	}
+
+	template <bool _ = true,
+	    RB_REQUIRES(_&& isIntegral<T>)>
+	friend Simd operator&(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::bitAnd(lhs.reg_, rhs.reg_)};
+	}
+
+	template <bool _ = true,
+	    RB_REQUIRES(_&& isIntegral<T>)>
+	friend Simd operator|(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::bitOr(lhs.reg_, rhs.reg_)};
+	}
+
+	template <bool _ = true,
+	    RB_REQUIRES(_&& isIntegral<T>)>
+	friend Simd operator^(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::bitXor(lhs.reg_, rhs.reg_)};
+	}
+
+	template <bool _ = true,
+	    RB_REQUIRES(_&& isIntegral<T>)>
+	friend Simd operator~(Simd value) noexcept {
+		return value ^ Simd{static_cast<T>(~T{})};
+	}
+
+	friend Mask operator==(Simd lhs, Simd rhs) noexcept {
+		return makeMask(Backend::eq(lhs.reg_, rhs.reg_));
+	}
+
+	friend Mask operator!=(Simd lhs, Simd rhs) noexcept {
+		return ~(lhs == rhs);
+	}
+
+	friend Mask operator<(Simd lhs, Simd rhs) noexcept {
+		return makeMask(Backend::lt(lhs.reg_, rhs.reg_));
+	}
+
+	friend Mask operator<=(Simd lhs, Simd rhs) noexcept {
+		return makeMask(Backend::le(lhs.reg_, rhs.reg_));
+	}
+
+	friend Mask operator>(Simd lhs, Simd rhs) noexcept {
+		return rhs < lhs;
+	}
+
+	friend Mask operator>=(Simd lhs, Simd rhs) noexcept {
+		return rhs <= lhs;
+	}
+
+	/// @return `lhs < rhs ? lhs : rhs` for each lane
+	friend Simd minimum(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::min(lhs.reg_, rhs.reg_)};
+	}
+
+	/// @return `rhs < lhs ? lhs : rhs` for each lane
+	friend Simd maximum(Simd lhs, Simd rhs) noexcept {
+		return Simd{Backend::max(lhs.reg_, rhs.reg_)};
+	}
+
+	/// @return `mask ? ifTrue : ifFalse` for each lane
+	friend Simd blend(Mask mask, Simd ifTrue, Simd ifFalse) noexcept {
+		return select(mask, ifTrue, ifFalse);
+	}
+
+private:
+	explicit Simd(Reg reg) noexcept
+	    : reg_(reg) {
+	}
+
+	// the hidden friends aren't friends of SimdMask, so they go through these
+	static Mask makeMask(typename Backend::Mask reg) noexcept {
+		return Mask{reg};
+	}
+
+	static Simd select(Mask mask, Simd ifTrue, Simd ifFalse) noexcept {
+		return Simd{Backend::select(mask.reg_, ifTrue.reg_, ifFalse.reg_)};
+	}
+
+	Reg reg_;
+};
+
+/// SimdMask is the result of comparisons of Simd vectors, each lane is either set or not.
+template <class T, usize n>
+class SimdMask {
+	using Backend = impl::simd::Backend<T, n>;
+	using Reg = typename Backend::Mask;
+
+public:
+	static constexpr usize size() noexcept {
+		return n;
+	}
+
+	/// @return the lanes packed into an integer, the first lane in the least significant bit, like `movemask` does.
+	u64 movemask() const noexcept {
+		return Backend::movemask(reg_);
+	}
+
+	bool any() const noexcept {
+		return movemask() != 0;
+	}
+
+	bool all() const noexcept {
+		return movemask() == impl::simd::kAllLanes<n>;
+	}
+
+	bool none() const noexcept {
+		return movemask() == 0;
+	}
+
+	bool operator[](usize i) const noexcept {
+		RB_ASSERT(i < n);
+		return (movemask() >> i) & 1U;
+	}
+
+	friend SimdMask operator&(SimdMask lhs, SimdMask rhs) noexcept {
+		return SimdMask{Backend::maskAnd(lhs.reg_, rhs.reg_)};
+	}
+
+	friend SimdMask operator|(SimdMask lhs, SimdMask rhs) noexcept {
+		return SimdMask{Backend::maskOr(lhs.reg_, rhs.reg_)};
+	}
+
+	friend SimdMask operator^(SimdMask lhs, SimdMask rhs) noexcept {
+		return SimdMask{Backend::maskXor(lhs.reg_, rhs.reg_)};
+	}
+
+	friend SimdMask operator~(SimdMask mask) noexcept {
+		return SimdMask{Backend::maskNot(mask.reg_)};
+	}
+
+private:
+	friend class Simd<T, n>;
+
+	explicit SimdMask(Reg reg) noexcept
+	    : reg_(reg) {
+	}
+
+	Reg reg_;
+};
+
+} // namespace rb::core
@@ -0,0 +1,288 @@
+#pragma once
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <tuple>
+
+#include <rb/core/attributes.hpp>
+#include <rb/core/InPlace.hpp>
+#include <rb/core/memory/EmptyBase.hpp>
+#include <rb/core/meta/TypeSeq.hpp>
+#include <rb/core/meta/ValueSeq.hpp>
+#include <rb/core/swap.hpp>
+#include <rb/core/traits/Constant.hpp>
+#include <rb/core/traits/Decay.hpp>
+#include <rb/core/traits/IsConvertible.hpp>
+
+namespace rb::core {
+
+template <class... Ts>
+class Tuple;
+
+namespace impl::tuple {
+
+	/// Every element is an EmptyBase tagged with its declared index, so equal types are still distinct bases.
+	template <usize idx, class T>
+	using Leaf = EmptyBase<T, static_cast<int>(idx)>;
+
+	template <usize n>
+	struct Order {
+		usize positions[n + 1];
+	};
+
+	/// Sorts element indices by decreasing alignment (stable), which leaves no padding between elements
+	/// since the size of a type is a multiple of its alignment.
+	template <class... Ts, usize... is>
+	constexpr Order<sizeof...(Ts)> makeOrder(ValueSeq<is...> /*unused*/) noexcept {
+		constexpr usize n = sizeof...(Ts);
+		usize const aligns[] = {alignof(Leaf<is, Ts>)..., 0};
+		Order<n> order{};
+		for (usize i = 0; i < n; ++i) {
+			usize j = i;
+			for (; j > 0 && aligns[order.positions[j - 1]] < aligns[i]; --j) {
+				order.positions[j] = order.positions[j - 1];
+			}
+			order.positions[j] = i;
+		}
+		return order;
+	}
+
+	template <class... Ts>
+	inline constexpr Order<sizeof...(Ts)> kOrder = makeOrder<Ts...>(IndexSeq<sizeof...(Ts)>());
+
+	template <usize i, class U, class... Us>
+	constexpr decltype(auto) nth(U&& u, Us&&... us) noexcept {
+		if constexpr (i == 0) {
+			return RB_FWD(u);
+		} else {
+			return nth<i - 1>(RB_FWD(us)...);
+		}
+	}
+
+	template <class Positions, class... Ts>
+	struct Storage;
+
+	// leaves are declared, and thus laid out, in the storage order, but are looked up by their declared index
+	template <usize... positions, class... Ts>
+	struct RB_EMPTY_BASES Storage<ValueSeq<positions...>, Ts...>
+	    : Leaf<positions, typename TypeSeq<Ts...>::template At<positions>>... {
+		constexpr Storage() = default;
+
+		template <class... Us>
+		constexpr explicit Storage(InPlace /*kInPlace*/, Us&&... us)
+		    : Leaf<positions, typename TypeSeq<Ts...>::template At<positions>>(kInPlace, nth<positions>(RB_FWD(us)...))... {
+		}
+	};
+
+	template <class... Ts, usize... js>
+	auto storageOf(ValueSeq<js...> /*unused*/) -> Storage<ValueSeq<kOrder<Ts...>.positions[js]...>, Ts...>;
+
+	template <class... Ts>
+	using StorageOf = decltype(storageOf<Ts...>(IndexSeq<sizeof...(Ts)>()));
+
+	template <bool sameSize, class Elements, class Args>
+	struct Conversion {
+		static constexpr bool kConstructible = false;
+		static constexpr bool kImplicit = false;
+	};
+
+	template <class... Ts, class... Us>
+	struct Conversion<true, TypeSeq<Ts...>, TypeSeq<Us...>> {
+		static constexpr bool kConstructible = (isConstructible<Ts, Us> && ...);
+		static constexpr bool kImplicit = (isConvertible<Us, Ts> && ...);
+	};
+
+	template <usize i, usize n>
+	struct Compare {
+		template <class L, class R>
+		static constexpr bool less(L const& lhs, R const& rhs) {
+			if (lhs.template get<i>() < rhs.template get<i>()) {
+				return true;
+			}
+			if (rhs.template get<i>() < lhs.template get<i>()) {
+				return false;
+			}
+			return Compare<i + 1, n>::less(lhs, rhs);
+		}
+	};
+
+	template <usize n>
+	struct Compare<n, n> {
+		template <class L, class R>
+		static constexpr bool less(L const& /*lhs*/, R const& /*rhs*/) {
+			return false;
+		}
+	};
+
+} // namespace impl::tuple
+
+/**
+ * The class Tuple is a fixed-size collection of heterogeneous values, like `std::tuple`, which is as compact
+ * as the elements allow:
+ * - empty elements take no space (see EmptyBase);
+ * - elements are stored by decreasing alignment, so there is no padding between them,
+ *   while `get<i>` still returns the `i`-th declared element;
+ * - the tuple is trivially copyable (destructible, etc.) if all elements are.
+ *
+ * Since elements are constructed in the storage order, initializers shouldn't depend on the order of evaluation.
+ */
+template <class... Ts>
+class Tuple {
+	using Storage = impl::tuple::StorageOf<Ts...>;
+
+	template <usize idx>
+	using Element = typename TypeSeq<Ts...>::template At<idx>;
+
+	template <usize idx>
+	using Leaf = impl::tuple::Leaf<idx, Element<idx>>;
+
+	template <class... Us>
+	using Conversion = impl::tuple::Conversion<sizeof...(Us) == sizeof...(Ts), TypeSeq<Ts...>, TypeSeq<Us...>>;
+
+	template <class... Us>
+	static constexpr bool kConstructibleFrom = sizeof...(Ts) >= 1
+	    && Conversion<Us...>::kConstructible
+	    // don't hide the copy and move constructors of a single-element tuple
+	    && !(sizeof...(Us) == 1 && (isSame<RemoveCvRef<Us>, Tuple> || ...));
+
+	template <class... Us>
+	static constexpr bool kConvertibleFrom = Conversion<Us...>::kImplicit;
+
+public:
+	static constexpr usize kSize = sizeof...(Ts);
+
+	constexpr Tuple() = default;
+
+	template <class... Us,
+	    RB_REQUIRES(kConstructibleFrom<Us...>&& kConvertibleFrom<Us...>)>
+	// ReSharper disable once CppNonExplicitConvertingConstructor
+	constexpr Tuple(Us&&... values) // NOLINT(*-forwarding-reference-overload, google-explicit-constructor)
+	    noexcept((isNothrowConstructible<Ts, Us> && ...))
+	    : storage_(kInPlace, RB_FWD(values)...) {
+	}
+
+	template <class... Us,
+	    RB_REQUIRES(kConstructibleFrom<Us...> && !kConvertibleFrom<Us...>)>
+	constexpr explicit Tuple(Us&&... values) // NOLINT(*-forwarding-reference-overload)
+	    noexcept((isNothrowConstructible<Ts, Us> && ...))
+	    : storage_(kInPlace, RB_FWD(values)...) {
+	}
+
+	template <usize idx>
+	constexpr Element<idx>& get() & noexcept {
+		return leaf<idx>().get();
+	}
+
+	template <usize idx>
+	constexpr Element<idx> const& get() const& noexcept {
+		return leaf<idx>().get();
+	}
+
+	template <usize idx>
+	constexpr Element<idx>&& get() && noexcept {
+		return static_cast<Element<idx>&&>(leaf<idx>().get());
+	}
+
+	template <usize idx>
+	constexpr Element<idx> const&& get() const&& noexcept {
+		return static_cast<Element<idx> const&&>(leaf<idx>().get());
+	}
+
+	constexpr void swap(Tuple& rhs) noexcept((isNothrowSwappable<Ts> && ...)) {
+		swap(rhs, IndexSeq<kSize>());
+	}
+
+	template <class... Us,
+	    RB_REQUIRES(sizeof...(Us) == kSize)>
+	friend constexpr bool operator==(Tuple const& lhs, Tuple<Us...> const& rhs) {
+		return equal(lhs, rhs, IndexSeq<kSize>());
+	}
+
+	template <class... Us,
+	    RB_REQUIRES(sizeof...(Us) == kSize)>
+	friend constexpr bool operator!=(Tuple const& lhs, Tuple<Us...> const& rhs) {
+		return !(lhs == rhs);
+	}
+
+	/// Compares elements lexicographically in the declared order.
+	template <class... Us,
+	    RB_REQUIRES(sizeof...(Us) == kSize)>
+	friend constexpr bool operator<(Tuple const& lhs, Tuple<Us...> const& rhs) {
+		return impl::tuple::Compare<0, kSize>::less(lhs, rhs);
+	}
+
+private:
+	template <usize idx>
+	constexpr Leaf<idx>& leaf() noexcept {
+		return storage_;
+	}
+
+	template <usize idx>
+	constexpr Leaf<idx> const& leaf() const noexcept {
+		return storage_;
+	}
+
+	template <usize... is>
+	constexpr void swap(Tuple& rhs, ValueSeq<is...> /*unused*/) {
+		using core::swap;
+
+		(swap(get<is>(), rhs.template get<is>()), ...);
+	}
+
+	template <class... Us, usize... is>
+	static constexpr bool equal(Tuple const& lhs, Tuple<Us...> const& rhs, ValueSeq<is...> /*unused*/) {
+		return ((lhs.template get<is>() == rhs.template get<is>()) && ...);
+	}
+
+	Storage storage_;
+};
+
+template <class... Ts>
+Tuple(Ts...) -> Tuple<Ts...>;
+
+template <class... Ts>
+constexpr Tuple<Decay<Ts>...> makeTuple(Ts&&... values) {
+	return Tuple<Decay<Ts>...>(RB_FWD(values)...);
+}
+
+template <usize idx, class... Ts>
+constexpr std::tuple_element_t<idx, Tuple<Ts...>>& get(Tuple<Ts...>& t) noexcept {
+	return t.template get<idx>();
+}
+
+template <usize idx, class... Ts>
+constexpr std::tuple_element_t<idx, Tuple<Ts...>> const& get(Tuple<Ts...> const& t) noexcept {
+	return t.template get<idx>();
+}
+
+template <usize idx, class... Ts>
+constexpr std::tuple_element_t<idx, Tuple<Ts...>>&& get(Tuple<Ts...>&& t) noexcept {
+	return RB_MOVE(t).template get<idx>();
+}
+
+template <usize idx, class... Ts>
+constexpr std::tuple_element_t<idx, Tuple<Ts...>> const&& get(Tuple<Ts...> const&& t) noexcept {
+	return RB_MOVE(t).template get<idx>();
+}
+
+template <class... Ts>
+constexpr void swap(Tuple<Ts...>& lhs, Tuple<Ts...>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+	lhs.swap(rhs);
+}
+
+} // namespace rb::core
+
+// NOLINTBEGIN(cert-dcl58-cpp)
+
+namespace std {
+
+template <class... Ts>
+struct tuple_size<rb::core::Tuple<Ts...>> : rb::core::Constant<sizeof...(Ts)> {};
+
+template <size_t idx, class... Ts>
+struct tuple_element<idx, rb::core::Tuple<Ts...>> {
+	using type = typename rb::core::TypeSeq<Ts...>::template At<idx>; // NOLINT(readability-identifier-naming)
+};
+
+} // namespace std
+
+// NOLINTEND(cert-dcl58-cpp)
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <ostream>
+#include <string_view>
+
+#include <rb/core/compiler.hpp>
+#include <rb/core/traits/remove.hpp>
+#include <rb/core/types.hpp>
+
+namespace rb::core {
+
+namespace impl {
+
+	template <class T>
+	constexpr std::string_view rawTypeName() noexcept {
+#ifdef RB_COMPILER_MSVC
+		return __FUNCSIG__;
+#else
+		return __PRETTY_FUNCTION__;
+#endif
+	}
+
+	// the decorated signature of `rawTypeName<void>()` tells where the type name starts and how much follows it
+	inline constexpr std::string_view kRawVoidName = rawTypeName<void>();
+	inline constexpr usize kTypeNamePrefix = kRawVoidName.find("void");
+	inline constexpr usize kTypeNameSuffix = kRawVoidName.size() - kTypeNamePrefix - std::string_view("void").size();
+
+	template <class T>
+	constexpr std::string_view typeName() noexcept {
+		constexpr std::string_view raw = rawTypeName<T>();
+		return raw.substr(kTypeNamePrefix, raw.size() - kTypeNamePrefix - kTypeNameSuffix);
+	}
+
+	// 64-bit FNV-1a
+	constexpr u64 hashTypeName(std::string_view name) noexcept {
+		u64 hash = 0xCBF2'9CE4'8422'2325;
+		for (char const c : name) {
+			hash = (hash ^ static_cast<unsigned char>(c)) * 0x0000'0100'0000'01B3;
+		}
+		return hash;
+	}
+
+	/// @return whether the type named @p name is declared in an unnamed namespace
+	constexpr bool hasInternalLinkage(std::string_view name) noexcept {
+		return name.find("{anonymous}") != std::string_view::npos            // GCC
+		    || name.find("(anonymous namespace)") != std::string_view::npos  // Clang
+		    || name.find("`anonymous namespace'") != std::string_view::npos; // MSVC
+	}
+
+} // namespace impl
+
+/**
+ * TypeId identifies a type without RTTI, so it's available in `-fno-rtti` builds and is a constant expression.
+ *
+ * The identity is a hash of the compiler-generated type name, so ids are equal across shared libraries
+ * and compare as integers, but types with internal linkage which are spelled the same in different
+ * translation units (e.g. two `{anonymous}::Node` classes) are indistinguishable, and distinct types may collide.
+ * Use it as a fast filter, not as the proof of identity.
+ * Like `typeid`, TypeId ignores references and top-level cv-qualifiers.
+ */
+class TypeId final {
+public:
+	/// Constructs the id of `void`.
+	constexpr TypeId() noexcept
+	    : TypeId(impl::typeName<void>()) {
+	}
+
+	template <class T>
+	static constexpr TypeId of() noexcept {
+		return TypeId(impl::typeName<RemoveCvRef<T>>());
+	}
+
+	/// @return the compiler-specific name of the type, e.g. `rb::core::TypeId`
+	constexpr std::string_view name() const noexcept {
+		return name_;
+	}
+
+	constexpr u64 hash() const noexcept {
+		return hash_;
+	}
+
+	constexpr bool operator==(TypeId rhs) const noexcept {
+		return hash_ == rhs.hash_;
+	}
+
+	constexpr bool operator!=(TypeId rhs) const noexcept {
+		return hash_ != rhs.hash_;
+	}
+
+	/// Orders ids by hash, which is arbitrary but stable between runs of the same build.
+	constexpr bool operator<(TypeId rhs) const noexcept {
+		return hash_ < rhs.hash_;
+	}
+
+private:
+	constexpr explicit TypeId(std::string_view name) noexcept
+	    : name_(name)
+	    , hash_(impl::hashTypeName(name)) {
+	}
+
+	std::string_view name_;
+	u64 hash_;
+};
+
+template <class T>
+inline constexpr TypeId kTypeId = TypeId::of<T>();
+
+inline std::ostream& operator<<(std::ostream& os, TypeId id) {
+	return os << "TypeId{" << id.name() << "}";
+}
+
+} // namespace rb::core
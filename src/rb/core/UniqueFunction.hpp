@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cstring>
+#include <new>
+
+#include <rb/core/exchange.hpp>
+#include <rb/core/FunctionRef.hpp>
+#include <rb/core/InPlace.hpp>
+#include <rb/core/traits/builtins.hpp>
+#include <rb/core/traits/destructible.hpp>
+#include <rb/core/traits/members.hpp>
+#include <rb/core/traits/requirements.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+
+namespace impl::function {
+
+	RB_WARNING_PUSH
+	RB_WARNING_PADDING
+
+	template <usize capacity, bool kConst, bool kNoexcept, class R, class... Args>
+	class UniqueFunctionBase {
+	protected:
+		static constexpr usize kInlineAlign = alignof(void*);
+
+		union Storage {
+			void* ptr;
+			alignas(kInlineAlign) unsigned char buffer[capacity < sizeof(void*) ? sizeof(void*) : capacity];
+		};
+
+	public:
+		static constexpr usize kCapacity = sizeof(Storage);
+
+		/// Whether a callable of type @p F is stored without allocation.
+		template <class F>
+		static constexpr bool kStoredInline = sizeof(F) <= kCapacity
+		    && kInlineAlign % alignof(F) == 0
+		    && isNothrowMoveConstructible<F>;
+
+		template <class F>
+		static constexpr bool kStorable = isMoveConstructible<F> && kInvocable<Callee<F, kConst>, kNoexcept, R, Args...>;
+
+		UniqueFunctionBase() noexcept = default;
+
+		UniqueFunctionBase(std::nullptr_t /*unused*/) noexcept { // NOLINT(google-explicit-constructor)
+		}
+
+		/// Stores a copy of @p f; a null function or member pointer yields an empty function.
+		template <class F,
+		    RB_REQUIRES(!isBaseOf<UniqueFunctionBase, Decay<F>> && !impl::isInPlaceType<Decay<F>>
+		                && kStorable<Decay<F>> && isConstructible<Decay<F>, F>)>
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		UniqueFunctionBase(F&& f) { // NOLINT(*-forwarding-reference-overload, google-explicit-constructor)
+			if constexpr (isPointer<Decay<F>> || isMemberPointer<Decay<F>>) {
+				if (f == nullptr) {
+					return;
+				}
+			}
+			emplace<Decay<F>>(RB_FWD(f));
+		}
+
+		template <class F, class... CArgs,
+		    RB_REQUIRES(kStorable<F>&& isConstructible<F, CArgs...>)>
+		explicit UniqueFunctionBase(InPlaceType<F> /*unused*/, CArgs&&... args) {
+			emplace<F>(RB_FWD(args)...);
+		}
+
+		UniqueFunctionBase(UniqueFunctionBase&& rhs) noexcept {
+			moveFrom(rhs);
+		}
+
+		UniqueFunctionBase(UniqueFunctionBase const&) = delete;
+		UniqueFunctionBase& operator=(UniqueFunctionBase const&) = delete;
+
+		~UniqueFunctionBase() {
+			reset();
+		}
+
+		UniqueFunctionBase& operator=(UniqueFunctionBase&& rhs) noexcept {
+			if (this != &rhs) {
+				reset();
+				moveFrom(rhs);
+			}
+			return *this;
+		}
+
+		UniqueFunctionBase& operator=(std::nullptr_t /*unused*/) noexcept {
+			reset();
+			return *this;
+		}
+
+		[[nodiscard]] explicit operator bool() const noexcept {
+			return invoker_ != nullptr;
+		}
+
+		void reset() noexcept {
+			if (ops_) {
+				exchange(ops_, nullptr)->destroy(storage_);
+			}
+			invoker_ = nullptr;
+		}
+
+		void swap(UniqueFunctionBase& rhs) noexcept {
+			if (this != &rhs) {
+				UniqueFunctionBase tmp(RB_MOVE(rhs));
+				rhs = RB_MOVE(*this);
+				*this = RB_MOVE(tmp);
+			}
+		}
+
+		friend bool operator==(UniqueFunctionBase const& lhs, std::nullptr_t /*unused*/) noexcept {
+			return !lhs;
+		}
+
+		friend bool operator!=(UniqueFunctionBase const& lhs, std::nullptr_t /*unused*/) noexcept {
+			return static_cast<bool>(lhs);
+		}
+
+	protected:
+		R call(Args&&... args) const noexcept(kNoexcept) {
+			RB_ASSERT_MSG("call of an empty UniqueFunction", invoker_ != nullptr);
+			// constness of the callable is enforced by the invoker, the storage is never const
+			return invoker_(const_cast<Storage&>(storage_), RB_FWD(args)...); // NOLINT(*-const-cast)
+		}
+
+	private:
+		using Invoker = R (*)(Storage& storage, Args&&...) noexcept(kNoexcept);
+
+		struct Ops {
+			void (*move)(Storage& dst, Storage& src) noexcept; // leaves `src` destroyed
+			void (*destroy)(Storage& storage) noexcept;
+		};
+
+		template <class F>
+		struct Manager {
+			static constexpr bool kInline = kStoredInline<F>;
+			// such callables are moved by copying the storage and need no destruction, so they have no Ops
+			static constexpr bool kTrivial = kInline && isTriviallyCopyable<F> && isTriviallyDestructible<F>;
+
+			static F* get(Storage& storage) noexcept {
+				if constexpr (kInline) {
+					return std::launder(reinterpret_cast<F*>(storage.buffer));
+				} else {
+					return static_cast<F*>(storage.ptr);
+				}
+			}
+
+			template <class... CArgs>
+			static void create(Storage& storage, CArgs&&... args) {
+				if constexpr (kInline) {
+					::new (static_cast<void*>(storage.buffer)) F(RB_FWD(args)...);
+				} else {
+					storage.ptr = new F(RB_FWD(args)...);
+				}
+			}
+
+			static R call(Storage& storage, Args&&... args) noexcept(kNoexcept) {
+				return invokeR<R>(static_cast<Callee<F, kConst>>(*get(storage)), RB_FWD(args)...);
+			}
+
+			static void move(Storage& dst, Storage& src) noexcept {
+				if constexpr (kInline) {
+					::new (static_cast<void*>(dst.buffer)) F(RB_MOVE(*get(src)));
+					get(src)->~F();
+				} else {
+					dst.ptr = exchange(src.ptr, nullptr);
+				}
+			}
+
+			static void destroy(Storage& storage) noexcept {
+				if constexpr (kInline) {
+					get(storage)->~F();
+				} else {
+					delete get(storage);
+				}
+			}
+
+			static constexpr Ops kOps = {&move, &destroy};
+		};
+
+		template <class F, class... CArgs>
+		void emplace(CArgs&&... args) {
+			Manager<F>::create(storage_, RB_FWD(args)...);
+			invoker_ = &Manager<F>::call;
+			if constexpr (!Manager<F>::kTrivial) {
+				ops_ = &Manager<F>::kOps;
+			}
+		}
+
+		void moveFrom(UniqueFunctionBase& rhs) noexcept {
+			if (rhs.ops_) {
+				rhs.ops_->move(storage_, rhs.storage_);
+				ops_ = exchange(rhs.ops_, nullptr);
+			} else if (rhs.invoker_) {
+				std::memcpy(&storage_, &rhs.storage_, sizeof(Storage));
+			}
+			invoker_ = exchange(rhs.invoker_, nullptr);
+		}
+
+		Storage storage_;
+		Invoker invoker_ = nullptr;
+		Ops const* ops_ = nullptr;
+	};
+
+	RB_WARNING_POP
+
+} // namespace impl::function
+
+/// The default capacity of UniqueFunction, which fits a lambda capturing three pointers.
+inline constexpr usize kUniqueFunctionCapacity = 3 * sizeof(void*);
+
+/**
+ * UniqueFunction is a move-only owner of a callable with signature @p Sig, e.g. `void() noexcept`,
+ * and replaces `std::function` where the callable is called by a single owner (tasks, callbacks).
+ *
+ * Since it's never copied, it accepts move-only callables and doesn't copy captures.
+ * Nothrow move constructible callables of up to @p capacity bytes are stored inline, so they never allocate;
+ * larger ones live on the heap.
+ * Trivially copyable inline callables (e.g. lambdas capturing pointers) are moved by copying bytes.
+ * A const signature makes `operator()` const and calls the callable as const,
+ * a `noexcept` one makes it `noexcept` and requires the callable to be nothrow invocable.
+ * Calling an empty UniqueFunction is a precondition violation.
+ */
+template <class Sig, usize capacity = kUniqueFunctionCapacity>
+class UniqueFunction;
+
+template <class R, class... Args, usize capacity>
+class UniqueFunction<R(Args...), capacity> final
+    : public impl::function::UniqueFunctionBase<capacity, false, false, R, Args...> {
+public:
+	using impl::function::UniqueFunctionBase<capacity, false, false, R, Args...>::UniqueFunctionBase;
+
+	R operator()(Args... args) {
+		return this->call(RB_FWD(args)...);
+	}
+};
+
+template <class R, class... Args, usize capacity>
+class UniqueFunction<R(Args...) const, capacity> final
+    : public impl::function::UniqueFunctionBase<capacity, true, false, R, Args...> {
+public:
+	using impl::function::UniqueFunctionBase<capacity, true, false, R, Args...>::UniqueFunctionBase;
+
+	R operator()(Args... args) const {
+		return this->call(RB_FWD(args)...);
+	}
+};
+
+template <class R, class... Args, usize capacity>
+class UniqueFunction<R(Args...) noexcept, capacity> final
+    : public impl::function::UniqueFunctionBase<capacity, false, true, R, Args...> {
+public:
+	using impl::function::UniqueFunctionBase<capacity, false, true, R, Args...>::UniqueFunctionBase;
+
+	R operator()(Args... args) noexcept {
+		return this->call(RB_FWD(args)...);
+	}
+};
+
+template <class R, class... Args, usize capacity>
+class UniqueFunction<R(Args...) const noexcept, capacity> final
+    : public impl::function::UniqueFunctionBase<capacity, true, true, R, Args...> {
+public:
+	using impl::function::UniqueFunctionBase<capacity, true, true, R, Args...>::UniqueFunctionBase;
+
+	R operator()(Args... args) const noexcept {
+		return this->call(RB_FWD(args)...);
+	}
+};
+
+template <class Sig, usize capacity>
+void swap(UniqueFunction<Sig, capacity>& lhs, UniqueFunction<Sig, capacity>& rhs) noexcept {
+	lhs.swap(rhs);
+}
+
+} // namespace rb::core
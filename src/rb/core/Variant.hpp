@@ -0,0 +1,800 @@
+#pragma once
+
+#include <new>
+#include <ostream>
+
+#include <rb/core/assert.hpp>
+#include <rb/core/enable_special_members.hpp>
+#include <rb/core/InPlace.hpp>
+#include <rb/core/invoke.hpp>
+#include <rb/core/memory/addressOf.hpp>
+#include <rb/core/meta/TypeSeq.hpp>
+#include <rb/core/meta/ValueSeq.hpp>
+#include <rb/core/move.hpp>
+#include <rb/core/NicheTraits.hpp>
+#include <rb/core/swap.hpp>
+#include <rb/core/traits/builtins.hpp>
+#include <rb/core/traits/Constant.hpp>
+#include <rb/core/traits/requirements.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+
+template <class... Ts>
+class Variant;
+
+/// Monostate is an empty alternative which makes a Variant default constructible or marks "no value".
+struct Monostate {};
+
+constexpr bool operator==(Monostate /*unused*/, Monostate /*unused*/) noexcept {
+	return true;
+}
+
+constexpr bool operator!=(Monostate /*unused*/, Monostate /*unused*/) noexcept {
+	return false;
+}
+
+constexpr bool operator<(Monostate /*unused*/, Monostate /*unused*/) noexcept {
+	return false;
+}
+
+inline std::ostream& operator<<(std::ostream& os, Monostate /*unused*/) {
+	return os << "Monostate";
+}
+
+/// The index of a valueless Variant.
+inline constexpr usize kVariantNpos = static_cast<usize>(-1);
+
+template <class V>
+struct VariantSize;
+
+template <class... Ts>
+struct VariantSize<Variant<Ts...>> : Constant<sizeof...(Ts)> {};
+
+template <class V>
+struct VariantSize<V const> : VariantSize<V> {};
+
+template <class V>
+inline constexpr usize kVariantSize = VariantSize<V>::value;
+
+template <usize idx, class V>
+struct VariantAlternative;
+
+template <usize idx, class... Ts>
+struct VariantAlternative<idx, Variant<Ts...>> {
+	using Type = typename TypeSeq<Ts...>::template At<idx>;
+};
+
+template <usize idx, class V>
+struct VariantAlternative<idx, V const> {
+	using Type = typename VariantAlternative<idx, V>::Type const;
+};
+
+template <usize idx, class V>
+using VariantAlternativeType = typename VariantAlternative<idx, V>::Type;
+
+namespace impl::variant {
+
+	/// The smallest unsigned type which holds `n` indices and the valueless index.
+	template <usize n>
+	using Index = Conditional<(n < 0xFF), u8, Conditional<(n < 0xFFFF), u16, u32>>;
+
+	struct Uninit {};
+
+	template <bool trivial, class... Ts>
+	union Union {};
+
+	template <class T, class... Ts>
+	union Union<true, T, Ts...> {
+		constexpr Union() noexcept
+		    : uninit{} {
+		}
+
+		template <class... Args>
+		constexpr explicit Union(InPlaceIndex<0> /*unused*/, Args&&... args)
+		    : head(RB_FWD(args)...) {
+		}
+
+		template <usize idx, class... Args>
+		constexpr explicit Union(InPlaceIndex<idx> /*unused*/, Args&&... args)
+		    : tail(kInPlaceIndex<idx - 1>, RB_FWD(args)...) {
+		}
+
+		Uninit uninit;
+		T head;
+		Union<true, Ts...> tail;
+	};
+
+	template <class T, class... Ts>
+	union Union<false, T, Ts...> {
+		constexpr Union() noexcept
+		    : uninit{} {
+		}
+
+		template <class... Args>
+		constexpr explicit Union(InPlaceIndex<0> /*unused*/, Args&&... args)
+		    : head(RB_FWD(args)...) {
+		}
+
+		template <usize idx, class... Args>
+		constexpr explicit Union(InPlaceIndex<idx> /*unused*/, Args&&... args)
+		    : tail(kInPlaceIndex<idx - 1>, RB_FWD(args)...) {
+		}
+
+		// the active member is destroyed by the owner, which knows its index
+		~Union() { // NOLINT(modernize-use-equals-default)
+		}
+
+		Uninit uninit;
+		T head;
+		Union<false, Ts...> tail;
+	};
+
+	template <usize idx, class U>
+	constexpr decltype(auto) get(U&& u) noexcept {
+		if constexpr (idx == 0) {
+			return (RB_FWD(u).head);
+		} else {
+			return get<idx - 1>(RB_FWD(u).tail);
+		}
+	}
+
+	template <usize n>
+	constexpr usize findUnique(bool const (&matches)[n]) noexcept {
+		usize found = kVariantNpos;
+		for (usize i = 0; i < n; ++i) {
+			if (matches[i]) {
+				if (found != kVariantNpos) {
+					return kVariantNpos;
+				}
+				found = i;
+			}
+		}
+		return found;
+	}
+
+	template <class T, class... Ts>
+	inline constexpr usize kIndexOf = findUnique({isSame<T, Ts>...});
+
+	// `bool` alternatives only accept `bool`, otherwise pointers and numbers would make most conversions ambiguous
+	template <class U, class T>
+	inline constexpr bool kConvertsTo = isSame<T, bool> ? isSame<Decay<U>, bool> : isConstructible<T, U>;
+
+	/// The alternative initialized by the converting constructor: the one of the same type if any,
+	/// otherwise the only one constructible from @p U.
+	template <class U, class... Ts>
+	inline constexpr usize kConversionIndex = kIndexOf<Decay<U>, Ts...> != kVariantNpos
+	    ? kIndexOf<Decay<U>, Ts...>
+	    : findUnique({kConvertsTo<U, Ts>...});
+
+	template <class... Ts>
+	struct Traits {
+		static constexpr usize kSize = sizeof...(Ts);
+
+		static constexpr bool kTriviallyDestructible = (isTriviallyDestructible<Ts> && ...);
+		static constexpr bool kTriviallyCopyConstructible = (isTriviallyCopyConstructible<Ts> && ...);
+		static constexpr bool kTriviallyMoveConstructible = (isTriviallyMoveConstructible<Ts> && ...);
+		static constexpr bool kTriviallyCopyAssignable = kTriviallyDestructible && kTriviallyCopyConstructible
+		    && (isTriviallyCopyAssignable<Ts> && ...);
+		static constexpr bool kTriviallyMoveAssignable = kTriviallyDestructible && kTriviallyMoveConstructible
+		    && (isTriviallyMoveAssignable<Ts> && ...);
+
+		static constexpr bool kCopyConstructible = (isCopyConstructible<Ts> && ...);
+		static constexpr bool kMoveConstructible = (isMoveConstructible<Ts> && ...);
+		static constexpr bool kCopyAssignable = kCopyConstructible && (isCopyAssignable<Ts> && ...);
+		static constexpr bool kMoveAssignable = kMoveConstructible && (isMoveAssignable<Ts> && ...);
+
+		// The index may be packed into niches of the only non-empty alternative,
+		// since constructing an empty alternative doesn't touch the storage.
+		// One niche per other alternative and one for the valueless state are needed.
+		static constexpr usize kDataful = findUnique({!isEmpty<Ts>...});
+		static constexpr bool kNiche = kSize >= 2 && kDataful != kVariantNpos
+		    && NicheTraits<typename TypeSeq<Ts...>::template At<kDataful == kVariantNpos ? 0 : kDataful>>::kCount
+		        >= kSize;
+	};
+
+	RB_WARNING_PUSH
+	RB_WARNING_PADDING
+
+	template <bool niche, class... Ts>
+	struct Storage {
+		using IndexType = Index<sizeof...(Ts)>;
+
+		constexpr Storage() noexcept
+		    : index_(static_cast<IndexType>(kVariantNpos)) {
+		}
+
+		template <usize idx, class... Args>
+		constexpr explicit Storage(InPlaceIndex<idx> tag, Args&&... args)
+		    : data(tag, RB_FWD(args)...)
+		    , index_(static_cast<IndexType>(idx)) {
+		}
+
+		constexpr usize index() const noexcept {
+			return index_ == static_cast<IndexType>(kVariantNpos) ? kVariantNpos : index_;
+		}
+
+		constexpr void setIndex(usize idx) noexcept {
+			index_ = static_cast<IndexType>(idx);
+		}
+
+		Union<Traits<Ts...>::kTriviallyDestructible, Ts...> data;
+		IndexType index_;
+	};
+
+	template <class... Ts>
+	struct Storage<true, Ts...> {
+		static constexpr usize kSize = sizeof...(Ts);
+		static constexpr usize kDataful = Traits<Ts...>::kDataful;
+		using Niche = NicheTraits<typename TypeSeq<Ts...>::template At<kDataful>>;
+
+		Storage() noexcept {
+			setIndex(kVariantNpos);
+		}
+
+		template <usize idx, class... Args>
+		constexpr explicit Storage(InPlaceIndex<idx> tag, Args&&... args)
+		    : data(tag, RB_FWD(args)...) {
+			if constexpr (idx != kDataful) {
+				setIndex(idx);
+			}
+		}
+
+		usize index() const noexcept {
+			usize const niche = Niche::load(addressOf(data));
+			if (niche == Niche::kCount) {
+				return kDataful;
+			}
+			if (niche == kSize - 1) {
+				return kVariantNpos;
+			}
+			return niche < kDataful ? niche : niche + 1;
+		}
+
+		// must be called after an empty alternative is constructed, and is a no-op for the dataful one
+		void setIndex(usize idx) noexcept {
+			if (idx == kDataful) {
+				return;
+			}
+			usize const niche = idx == kVariantNpos ? kSize - 1 : idx < kDataful ? idx : idx - 1;
+			Niche::store(addressOf(data), niche);
+		}
+
+		Union<Traits<Ts...>::kTriviallyDestructible, Ts...> data;
+	};
+
+	template <class F, class Seq>
+	struct Dispatcher;
+
+	/// Calls `fn(Constant<idx>())` for a runtime index through a table of function pointers.
+	template <class F, usize... is>
+	struct Dispatcher<F, ValueSeq<is...>> {
+		using Result = decltype(RB_DECLVAL(F&)(Constant<usize{0}>()));
+		using Thunk = Result (*)(F&);
+
+		template <usize idx>
+		static Result thunk(F& fn) {
+			return fn(Constant<idx>());
+		}
+
+		static constexpr Thunk kTable[] = {&thunk<is>...};
+	};
+
+	template <usize n, class F>
+	decltype(auto) dispatch(usize idx, F&& fn) {
+		RB_ASSERT(idx < n);
+		return Dispatcher<RemoveRef<F>, IndexSeq<n>>::kTable[idx](fn);
+	}
+
+	template <class... Ts>
+	struct Ops {
+		static constexpr usize kSize = sizeof...(Ts);
+
+		template <class S>
+		static void reset(S& self) noexcept {
+			usize const idx = self.index();
+			if (idx == kVariantNpos) {
+				return;
+			}
+			if constexpr (!Traits<Ts...>::kTriviallyDestructible) {
+				dispatch<kSize>(idx, [&](auto c) {
+					using T = typename TypeSeq<Ts...>::template At<c>;
+					get<c>(self.data).~T();
+				});
+			}
+			self.setIndex(kVariantNpos);
+		}
+
+		/// @p self must be valueless.
+		template <usize idx, class S, class... Args>
+		static void construct(S& self, Args&&... args) {
+			using T = typename TypeSeq<Ts...>::template At<idx>;
+			::new (static_cast<void*>(addressOf(get<idx>(self.data)))) T(RB_FWD(args)...);
+			self.setIndex(idx);
+		}
+
+		/// @p self must be valueless.
+		template <class S, class R>
+		static void constructFrom(S& self, R&& rhs) {
+			usize const idx = rhs.index();
+			if (idx != kVariantNpos) {
+				dispatch<kSize>(idx, [&](auto c) {
+					construct<c>(self, get<c>(RB_FWD(rhs).data));
+				});
+			}
+		}
+
+		template <class S, class R>
+		static void assignFrom(S& self, R&& rhs) {
+			usize const idx = rhs.index();
+			if (idx == kVariantNpos) {
+				reset(self);
+			} else if (idx == self.index()) {
+				dispatch<kSize>(idx, [&](auto c) {
+					get<c>(self.data) = get<c>(RB_FWD(rhs).data);
+				});
+			} else {
+				reset(self);
+				constructFrom(self, RB_FWD(rhs));
+			}
+		}
+	};
+
+	// Every layer below implements a single special member, non-trivially only if some alternative needs it,
+	// so the Variant of trivial types is trivial in the same way as Option.
+
+	template <bool trivial, class... Ts>
+	struct Destructor : Storage<Traits<Ts...>::kNiche, Ts...> {
+		using Storage<Traits<Ts...>::kNiche, Ts...>::Storage;
+	};
+
+	template <class... Ts>
+	struct Destructor<false, Ts...> : Storage<Traits<Ts...>::kNiche, Ts...> {
+		using Storage<Traits<Ts...>::kNiche, Ts...>::Storage;
+
+		Destructor() = default;
+		Destructor(Destructor const&) = default;
+		Destructor(Destructor&&) = default;
+		Destructor& operator=(Destructor const&) = default;
+		Destructor& operator=(Destructor&&) = default;
+
+		~Destructor() {
+			Ops<Ts...>::reset(*this);
+		}
+	};
+
+	template <class... Ts>
+	using DestructorFor = Destructor<Traits<Ts...>::kTriviallyDestructible, Ts...>;
+
+	template <bool trivial, class... Ts>
+	struct CopyConstructor : DestructorFor<Ts...> {
+		using DestructorFor<Ts...>::DestructorFor;
+	};
+
+	template <class... Ts>
+	struct CopyConstructor<false, Ts...> : DestructorFor<Ts...> {
+		using DestructorFor<Ts...>::DestructorFor;
+
+		CopyConstructor() = default;
+
+		CopyConstructor(CopyConstructor const& rhs)
+		    : DestructorFor<Ts...>() {
+			Ops<Ts...>::constructFrom(*this, rhs);
+		}
+
+		CopyConstructor(CopyConstructor&&) = default;
+		CopyConstructor& operator=(CopyConstructor const&) = default;
+		CopyConstructor& operator=(CopyConstructor&&) = default;
+		~CopyConstructor() = default;
+	};
+
+	template <class... Ts>
+	using CopyConstructorFor = CopyConstructor<Traits<Ts...>::kTriviallyCopyConstructible, Ts...>;
+
+	template <bool trivial, class... Ts>
+	struct MoveConstructor : CopyConstructorFor<Ts...> {
+		using CopyConstructorFor<Ts...>::CopyConstructorFor;
+	};
+
+	template <class... Ts>
+	struct MoveConstructor<false, Ts...> : CopyConstructorFor<Ts...> {
+		using CopyConstructorFor<Ts...>::CopyConstructorFor;
+
+		MoveConstructor() = default;
+		MoveConstructor(MoveConstructor const&) = default;
+
+		MoveConstructor(MoveConstructor&& rhs) noexcept((isNothrowMoveConstructible<Ts> && ...))
+		    : CopyConstructorFor<Ts...>() {
+			Ops<Ts...>::constructFrom(*this, RB_MOVE(rhs));
+		}
+
+		MoveConstructor& operator=(MoveConstructor const&) = default;
+		MoveConstructor& operator=(MoveConstructor&&) = default;
+		~MoveConstructor() = default;
+	};
+
+	template <class... Ts>
+	using MoveConstructorFor = MoveConstructor<Traits<Ts...>::kTriviallyMoveConstructible, Ts...>;
+
+	template <bool trivial, class... Ts>
+	struct CopyAssignment : MoveConstructorFor<Ts...> {
+		using MoveConstructorFor<Ts...>::MoveConstructorFor;
+	};
+
+	template <class... Ts>
+	struct CopyAssignment<false, Ts...> : MoveConstructorFor<Ts...> {
+		using MoveConstructorFor<Ts...>::MoveConstructorFor;
+
+		CopyAssignment() = default;
+		CopyAssignment(CopyAssignment const&) = default;
+		CopyAssignment(CopyAssignment&&) = default;
+
+		CopyAssignment& operator=(CopyAssignment const& rhs) {
+			if (this != &rhs) {
+				Ops<Ts...>::assignFrom(*this, rhs);
+			}
+			return *this;
+		}
+
+		CopyAssignment& operator=(CopyAssignment&&) = default;
+		~CopyAssignment() = default;
+	};
+
+	template <class... Ts>
+	using CopyAssignmentFor = CopyAssignment<Traits<Ts...>::kTriviallyCopyAssignable, Ts...>;
+
+	template <bool trivial, class... Ts>
+	struct MoveAssignment : CopyAssignmentFor<Ts...> {
+		using CopyAssignmentFor<Ts...>::CopyAssignmentFor;
+	};
+
+	template <class... Ts>
+	struct MoveAssignment<false, Ts...> : CopyAssignmentFor<Ts...> {
+		using CopyAssignmentFor<Ts...>::CopyAssignmentFor;
+
+		MoveAssignment() = default;
+		MoveAssignment(MoveAssignment const&) = default;
+		MoveAssignment(MoveAssignment&&) = default;
+		MoveAssignment& operator=(MoveAssignment const&) = default;
+
+		MoveAssignment& operator=(MoveAssignment&& rhs) //
+		    noexcept(((isNothrowMoveConstructible<Ts> && isNothrowMoveAssignable<Ts>) && ...)) {
+			if (this != &rhs) {
+				Ops<Ts...>::assignFrom(*this, RB_MOVE(rhs));
+			}
+			return *this;
+		}
+
+		~MoveAssignment() = default;
+	};
+
+	template <class... Ts>
+	using Base = MoveAssignment<Traits<Ts...>::kTriviallyMoveAssignable, Ts...>;
+
+	RB_WARNING_POP
+
+	template <class T>
+	struct IsVariant : False {};
+
+	template <class... Ts>
+	struct IsVariant<Variant<Ts...>> : True {};
+
+	/// The access to the storage of a variant, which is a private base of Variant.
+	template <class V>
+	constexpr decltype(auto) data(V&& v) noexcept {
+		using Base = Conditional<isConst<RemoveRef<V>>,
+		    typename RemoveCvRef<V>::Base const,
+		    typename RemoveCvRef<V>::Base>;
+		return (static_cast<Conditional<isLValueRef<V>, Base&, Base&&>>(v).data);
+	}
+
+	template <class R, class F, class Vs, class Seq>
+	struct MultiDispatcher;
+
+	/// A single table of `size(V1) * size(V2) * ...` entries, indexed by the mixed-radix number of the indices.
+	template <class R, class F, class... Vs, usize... flat>
+	struct MultiDispatcher<R, F, TypeSeq<Vs...>, ValueSeq<flat...>> {
+		static constexpr usize kSizes[] = {kVariantSize<RemoveRef<Vs>>...};
+
+		template <usize f, usize k>
+		static constexpr usize indexOf() noexcept {
+			usize stride = 1;
+			for (usize j = k + 1; j < sizeof...(Vs); ++j) {
+				stride *= kSizes[j];
+			}
+			return f / stride % kSizes[k];
+		}
+
+		template <usize f, usize... ks>
+		static R call(ValueSeq<ks...> /*unused*/, F&& fn, Vs&&... vs) {
+			return invoke(RB_FWD(fn), get<indexOf<f, ks>()>(data(RB_FWD(vs)))...);
+		}
+
+		template <usize f>
+		static R thunk(F&& fn, Vs&&... vs) {
+			return call<f>(IndexSeq<sizeof...(Vs)>(), RB_FWD(fn), RB_FWD(vs)...);
+		}
+
+		using Thunk = R (*)(F&&, Vs&&...);
+
+		static constexpr Thunk kTable[] = {&thunk<flat>...};
+	};
+
+	template <class... Vs>
+	constexpr usize product() noexcept {
+		return (usize{1} * ... * kVariantSize<RemoveRef<Vs>>);
+	}
+
+	template <class V>
+	constexpr void flatIndex(usize& flat, V const& v) noexcept {
+		usize const idx = v.index();
+		RB_ASSERT_MSG("visiting a valueless variant", idx != kVariantNpos);
+		flat = flat * kVariantSize<RemoveCvRef<V>> + idx;
+	}
+
+} // namespace impl::variant
+
+template <class T>
+inline constexpr bool isVariant = impl::variant::IsVariant<RemoveCvRef<T>>::value;
+
+RB_WARNING_PUSH
+RB_WARNING_PADDING
+
+/**
+ * The class template Variant holds a value of one of the alternative types @p Ts.
+ *
+ * Unlike `std::variant`:
+ * - the index is the smallest unsigned type which fits, so `Variant<u32, f32>` is 8 bytes;
+ * - when all alternatives but one are empty (e.g. `Variant<bool, Monostate>`) and the remaining one has enough niches
+ *   (see NicheTraits), the index is packed into them and the variant is no larger than that alternative;
+ * - visit() with any number of variants compiles into a single table of function pointers;
+ * - invalid accesses are checked with assertions, like in Option, rather than exceptions.
+ *
+ * The variant is trivially copyable/destructible whenever all alternatives are.
+ * It becomes valueless if the construction of the new alternative throws during emplace() or assignment.
+ */
+template <class... Ts>
+class Variant final
+    : impl::variant::Base<Ts...>
+    , EnableCopyMove<
+          impl::variant::Traits<Ts...>::kCopyConstructible,
+          impl::variant::Traits<Ts...>::kCopyAssignable,
+          impl::variant::Traits<Ts...>::kMoveConstructible,
+          impl::variant::Traits<Ts...>::kMoveAssignable,
+          Variant<Ts...>> {
+	static_assert(sizeof...(Ts) > 0, "variant must have at least one alternative");
+	static_assert(((isObject<Ts> && !isArray<Ts>) && ...), "alternatives must be non-array object types");
+
+	using Base = impl::variant::Base<Ts...>;
+	using Ops = impl::variant::Ops<Ts...>;
+	using Types = TypeSeq<Ts...>;
+
+	template <class V>
+	friend constexpr decltype(auto) impl::variant::data(V&& v) noexcept;
+
+	template <usize idx>
+	using Alternative = typename Types::template At<idx>;
+
+	template <class T>
+	static constexpr usize kIndexOf = impl::variant::kIndexOf<T, Ts...>;
+
+public:
+	template <bool _ = true,
+	    RB_REQUIRES(_&& isDefaultConstructible<Alternative<0>>)>
+	constexpr Variant() noexcept(isNothrowDefaultConstructible<Alternative<0>>)
+	    : Base(kInPlaceIndex<0>) {
+	}
+
+	Variant(Variant const&) = default;
+	Variant(Variant&&) = default;
+
+	template <class U,
+	    usize idx = impl::variant::kConversionIndex<U, Ts...>,
+	    RB_REQUIRES(!isSame<Decay<U>, Variant> && !impl::isInPlaceType<Decay<U>> && idx != kVariantNpos)>
+	constexpr Variant(U&& value) // NOLINT(*-forwarding-reference-overload,google-explicit-constructor)
+	    noexcept(isNothrowConstructible<Alternative<idx>, U>)
+	    : Base(kInPlaceIndex<idx>, RB_FWD(value)) {
+	}
+
+	template <class T, class... Args,
+	    usize idx = kIndexOf<T>,
+	    RB_REQUIRES(idx != kVariantNpos && isConstructible<T, Args...>)>
+	constexpr explicit Variant(InPlaceType<T> /*unused*/, Args&&... args)
+	    : Base(kInPlaceIndex<idx>, RB_FWD(args)...) {
+	}
+
+	template <usize idx, class... Args,
+	    RB_REQUIRES(idx < sizeof...(Ts))>
+	constexpr explicit Variant(InPlaceIndex<idx> tag, Args&&... args)
+	    : Base(tag, RB_FWD(args)...) {
+	}
+
+	~Variant() = default;
+
+	Variant& operator=(Variant const&) = default;
+	Variant& operator=(Variant&&) = default;
+
+	template <class U,
+	    usize idx = impl::variant::kConversionIndex<U, Ts...>,
+	    RB_REQUIRES(!isSame<Decay<U>, Variant> && idx != kVariantNpos)>
+	Variant& operator=(U&& value) {
+		if (index() == idx) {
+			get<idx>() = RB_FWD(value);
+		} else {
+			emplace<idx>(RB_FWD(value));
+		}
+		return *this;
+	}
+
+	/// @return zero-based index of the alternative held, or #kVariantNpos if the variant is valueless
+	constexpr usize index() const noexcept {
+		return Base::index();
+	}
+
+	constexpr bool isValueless() const noexcept {
+		return index() == kVariantNpos;
+	}
+
+	template <class T>
+	constexpr bool holds() const noexcept {
+		static_assert(kIndexOf<T> != kVariantNpos, "T must occur exactly once in alternatives");
+		return index() == kIndexOf<T>;
+	}
+
+	/// Destroys the current value and constructs alternative @p idx in-place.
+	/// @return A reference to the new contained object.
+	template <usize idx, class... Args,
+	    RB_REQUIRES(idx < sizeof...(Ts))>
+	Alternative<idx>& emplace(Args&&... args) {
+		Ops::reset(static_cast<Base&>(*this));
+		Ops::template construct<idx>(static_cast<Base&>(*this), RB_FWD(args)...);
+		return get<idx>();
+	}
+
+	template <class T, class... Args,
+	    usize idx = kIndexOf<T>,
+	    RB_REQUIRES(idx != kVariantNpos)>
+	T& emplace(Args&&... args) {
+		return emplace<idx>(RB_FWD(args)...);
+	}
+
+	template <usize idx>
+	constexpr Alternative<idx>& get() & noexcept {
+		RB_ASSERT(index() == idx);
+		return impl::variant::get<idx>(this->data);
+	}
+
+	template <usize idx>
+	constexpr Alternative<idx> const& get() const& noexcept {
+		RB_ASSERT(index() == idx);
+		return impl::variant::get<idx>(this->data);
+	}
+
+	template <usize idx>
+	constexpr Alternative<idx>&& get() && noexcept {
+		RB_ASSERT(index() == idx);
+		return impl::variant::get<idx>(RB_MOVE(this->data));
+	}
+
+	template <class T>
+	constexpr T& get() & noexcept {
+		return get<kIndexOf<T>>();
+	}
+
+	template <class T>
+	constexpr T const& get() const& noexcept {
+		return get<kIndexOf<T>>();
+	}
+
+	template <class T>
+	constexpr T&& get() && noexcept {
+		return RB_MOVE(*this).template get<kIndexOf<T>>();
+	}
+
+	/// @return pointer to alternative @p idx if it's held, otherwise `nullptr`
+	template <usize idx>
+	constexpr Alternative<idx>* getIf() noexcept {
+		return index() == idx ? addressOf(impl::variant::get<idx>(this->data)) : nullptr;
+	}
+
+	template <usize idx>
+	constexpr Alternative<idx> const* getIf() const noexcept {
+		return index() == idx ? addressOf(impl::variant::get<idx>(this->data)) : nullptr;
+	}
+
+	template <class T>
+	constexpr T* getIf() noexcept {
+		return getIf<kIndexOf<T>>();
+	}
+
+	template <class T>
+	constexpr T const* getIf() const noexcept {
+		return getIf<kIndexOf<T>>();
+	}
+
+	void swap(Variant& rhs) noexcept(((isNothrowMoveConstructible<Ts> && isNothrowSwappable<Ts>) && ...)) {
+		if (index() == rhs.index()) {
+			if (!isValueless()) {
+				impl::variant::dispatch<sizeof...(Ts)>(index(), [&](auto c) {
+					using core::swap;
+					swap(get<c>(), rhs.template get<c>());
+				});
+			}
+		} else {
+			Variant tmp(RB_MOVE(rhs));
+			rhs = RB_MOVE(*this);
+			*this = RB_MOVE(tmp);
+		}
+	}
+
+	/// Variants are equal if they hold the same alternative with equal values, or are both valueless.
+	friend bool operator==(Variant const& lhs, Variant const& rhs) {
+		if (lhs.index() != rhs.index()) {
+			return false;
+		}
+		if (lhs.isValueless()) {
+			return true;
+		}
+		return impl::variant::dispatch<sizeof...(Ts)>(lhs.index(), [&](auto c) -> bool {
+			return lhs.template get<c>() == rhs.template get<c>();
+		});
+	}
+
+	friend bool operator!=(Variant const& lhs, Variant const& rhs) {
+		return !(lhs == rhs);
+	}
+
+	/// Orders variants by index first (a valueless variant is the least), then by value.
+	friend bool operator<(Variant const& lhs, Variant const& rhs) {
+		if (lhs.index() != rhs.index()) {
+			return lhs.index() + 1 < rhs.index() + 1;
+		}
+		if (lhs.isValueless()) {
+			return false;
+		}
+		return impl::variant::dispatch<sizeof...(Ts)>(lhs.index(), [&](auto c) -> bool {
+			return lhs.template get<c>() < rhs.template get<c>();
+		});
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, Variant const& v) {
+		if (v.isValueless()) {
+			return os << "Variant{}";
+		}
+		impl::variant::dispatch<sizeof...(Ts)>(v.index(), [&](auto c) {
+			if constexpr (isWritableTo<Alternative<c>, std::ostream>) {
+				os << v.template get<c>();
+			} else {
+				os << "Variant{?}";
+			}
+		});
+		return os;
+	}
+};
+
+RB_WARNING_POP
+
+template <class... Ts>
+void swap(Variant<Ts...>& lhs, Variant<Ts...>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+	lhs.swap(rhs);
+}
+
+/**
+ * Calls @p fn with the values held by @p vs.
+ *
+ * All combinations of alternatives are dispatched through one table of function pointers, indexed by the
+ * indices of @p vs as a mixed-radix number, so even multi-variant visitation costs a single indirect call.
+ * Every call must return the type returned for the first alternatives; no variant may be valueless.
+ */
+template <class F, class... Vs,
+    RB_REQUIRES(sizeof...(Vs) > 0 && (isVariant<Vs> && ...))>
+decltype(auto) visit(F&& fn, Vs&&... vs) {
+	using R = decltype(invoke(RB_FWD(fn), impl::variant::get<0>(impl::variant::data(RB_FWD(vs)))...));
+	using Dispatcher = impl::variant::MultiDispatcher<R, F, TypeSeq<Vs...>, IndexSeq<impl::variant::product<Vs...>()>>;
+
+	usize flat = 0;
+	(impl::variant::flatIndex(flat, vs), ...);
+	return Dispatcher::kTable[flat](RB_FWD(fn), RB_FWD(vs)...);
+}
+
+} // namespace rb::core
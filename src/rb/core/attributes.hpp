@@ -141,3 +141,10 @@
 
 #define RB_OPEN_FLAG_ENUM \
 	RB_OPEN_ENUM RB_FLAG_ENUM
+
+/// MSVC applies the empty base optimization to the first empty base only unless asked to.
+#if defined(RB_COMPILER_MSVC)
+	#define RB_EMPTY_BASES __declspec(empty_bases)
+#else
+	#define RB_EMPTY_BASES
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <rb/core/compiler.hpp>
+#include <rb/core/has.hpp>
 
 #if defined(RB_COMPILER_GCC_LIKE) || defined(RB_COMPILER_CLANG)
 	#define RB_BUILTIN_FILE __builtin_FILE()
@@ -78,3 +79,12 @@ namespace rb::core {
 #else
 	#define RB_CURRENT_FUNCTION "(unknown)"
 #endif
+
+// without the builtin, constant evaluation is assumed, so callers take their portable path
+#if RB_HAS_BUILTIN(__builtin_is_constant_evaluated)               \
+    || defined(RB_COMPILER_GCC) && RB_COMPILER_VERSION_MAJOR >= 9 \
+    || defined(RB_COMPILER_MSVC) && _MSC_VER >= 1925
+	#define RB_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+	#define RB_IS_CONSTANT_EVALUATED() true
+#endif
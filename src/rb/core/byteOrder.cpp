@@ -0,0 +1,171 @@
+#include "byteOrder.hpp"
+
+#include <rb/core/bits.hpp>
+#include <rb/core/CpuFeatures.hpp>
+
+#if RB_BYTE_ORDER_X86
+	#include <immintrin.h>
+#elif RB_BYTE_ORDER_NEON
+	#include <arm_neon.h>
+#endif
+
+using namespace rb::core;
+
+namespace {
+
+template <unsigned size>
+using Word = typename rb::core::impl::UnsignedOfSize<size>::Type;
+
+template <unsigned size>
+void bswapScalar(byte const* src, byte* dst, usize count) noexcept {
+	for (usize i = 0; i < count; ++i) {
+		Word<size> value;
+		std::memcpy(&value, src + i * size, size);
+		value = bswap(value);
+		std::memcpy(dst + i * size, &value, size);
+	}
+}
+
+// NOLINTBEGIN(*-reinterpret-cast)
+
+#if RB_BYTE_ORDER_X86
+
+// `pshufb` masks which reverse each 2, 4 and 8 bytes of a 16-byte block
+alignas(16) constexpr u8 kShuffles[3][16] = {
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+    {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8},
+};
+
+template <unsigned size>
+RB_TARGET("avx2")
+void bswapAvx2(byte const* src, byte* dst, usize count) noexcept {
+	usize const bytes = count * size;
+	usize i = 0;
+	__m128i const mask = _mm_load_si128(reinterpret_cast<__m128i const*>(kShuffles[size / 4]));
+	// `vpshufb` shuffles within 128-bit lanes, which is enough since the elements don't cross them
+	__m256i const mask256 = _mm256_broadcastsi128_si256(mask);
+	for (; i + 32 <= bytes; i += 32) {
+		__m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(v, mask256));
+	}
+	if (i + 16 <= bytes) {
+		__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+		i += 16;
+	}
+	bswapScalar<size>(src + i, dst + i, count - i / size);
+}
+
+template <unsigned size>
+RB_TARGET("ssse3")
+void bswapSsse3(byte const* src, byte* dst, usize count) noexcept {
+	usize const bytes = count * size;
+	usize i = 0;
+	__m128i const mask = _mm_load_si128(reinterpret_cast<__m128i const*>(kShuffles[size / 4]));
+	for (; i + 16 <= bytes; i += 16) {
+		__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+	}
+	bswapScalar<size>(src + i, dst + i, count - i / size);
+}
+
+// without `pshufb` the 16-bit words are reversed first, and then the bytes within each word are swapped
+template <unsigned size>
+void bswapSse2(byte const* src, byte* dst, usize count) noexcept {
+	usize const bytes = count * size;
+	usize i = 0;
+	for (; i + 16 <= bytes; i += 16) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+		if constexpr (size == 4) {
+			v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+		} else if constexpr (size == 8) {
+			v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+		}
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+	}
+	bswapScalar<size>(src + i, dst + i, count - i / size);
+}
+
+#elif RB_BYTE_ORDER_NEON
+
+template <unsigned size>
+void bswapNeon(byte const* src, byte* dst, usize count) noexcept {
+	usize const bytes = count * size;
+	usize i = 0;
+	for (; i + 16 <= bytes; i += 16) {
+		uint8x16_t v = vld1q_u8(reinterpret_cast<u8 const*>(src + i));
+		if constexpr (size == 2) {
+			v = vrev16q_u8(v);
+		} else if constexpr (size == 4) {
+			v = vrev32q_u8(v);
+		} else {
+			v = vrev64q_u8(v);
+		}
+		vst1q_u8(reinterpret_cast<u8*>(dst + i), v);
+	}
+	bswapScalar<size>(src + i, dst + i, count - i / size);
+}
+
+#endif
+
+// NOLINTEND(*-reinterpret-cast)
+
+template <unsigned size>
+void bswapCopy(byte const* src, byte* dst, usize count) noexcept {
+#if RB_BYTE_ORDER_X86
+	RB_MULTIVERSION(bswapSse2<size>, {CpuFeature::kAvx2, bswapAvx2<size>}, {CpuFeature::kSsse3, bswapSsse3<size>})
+	(src, dst, count);
+#elif RB_BYTE_ORDER_NEON
+	bswapNeon<size>(src, dst, count);
+#else
+	bswapScalar<size>(src, dst, count);
+#endif
+}
+
+using Kernel = void (*)(byte const* src, byte* dst, usize count) noexcept;
+
+// calls the instance of a kernel for the element size
+void dispatch(void const* src, void* dst, usize count, usize size, Kernel k2, Kernel k4, Kernel k8) noexcept {
+	auto const* from = static_cast<byte const*>(src);
+	auto* to = static_cast<byte*>(dst);
+	switch (size) {
+		case 2 : return k2(from, to, count);
+		case 4 : return k4(from, to, count);
+		case 8 : return k8(from, to, count);
+		default: RB_UNREACHABLE_ASSERT();
+	}
+}
+
+} // namespace
+
+void rb::core::impl::byteOrder::bswapCopy(void const* src, void* dst, usize count, usize size) noexcept {
+	dispatch(src, dst, count, size, ::bswapCopy<2>, ::bswapCopy<4>, ::bswapCopy<8>);
+}
+
+void rb::core::impl::byteOrder::bswapScalar(void const* src, void* dst, usize count, usize size) noexcept {
+	dispatch(src, dst, count, size, ::bswapScalar<2>, ::bswapScalar<4>, ::bswapScalar<8>);
+}
+
+#if RB_BYTE_ORDER_X86
+
+void rb::core::impl::byteOrder::bswapSse2(void const* src, void* dst, usize count, usize size) noexcept {
+	dispatch(src, dst, count, size, ::bswapSse2<2>, ::bswapSse2<4>, ::bswapSse2<8>);
+}
+
+void rb::core::impl::byteOrder::bswapSsse3(void const* src, void* dst, usize count, usize size) noexcept {
+	dispatch(src, dst, count, size, ::bswapSsse3<2>, ::bswapSsse3<4>, ::bswapSsse3<8>);
+}
+
+void rb::core::impl::byteOrder::bswapAvx2(void const* src, void* dst, usize count, usize size) noexcept {
+	dispatch(src, dst, count, size, ::bswapAvx2<2>, ::bswapAvx2<4>, ::bswapAvx2<8>);
+}
+
+#elif RB_BYTE_ORDER_NEON
+
+void rb::core::impl::byteOrder::bswapNeon(void const* src, void* dst, usize count, usize size) noexcept {
+	dispatch(src, dst, count, size, ::bswapNeon<2>, ::bswapNeon<4>, ::bswapNeon<8>);
+}
+
+#endif
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstring>
+
+#include <rb/core/assert.hpp>
+#include <rb/core/endian.hpp>
+#include <rb/core/export.hpp>
+#include <rb/core/processor.hpp>
+#include <rb/core/Span.hpp>
+#include <rb/core/traits/IsArithmetic.hpp>
+
+#if defined(RB_PROCESSOR_X86) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RB_BYTE_ORDER_X86 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#define RB_BYTE_ORDER_NEON 1
+#endif
+
+namespace rb::core {
+
+namespace impl::byteOrder {
+
+	/**
+	 * Copies @p count elements of @p size bytes from @p src to @p dst, reversing the bytes of each element.
+	 * The buffers may be the same, but must not overlap otherwise.
+	 * @pre @p size is 2, 4 or 8
+	 */
+	RB_EXPORT void bswapCopy(void const* src, void* dst, usize count, usize size) noexcept;
+
+	// The kernels bswapCopy() chooses from, with the same contract; they are exported to test each of them.
+	// The SIMD ones must only be called when the running CPU supports their instruction set.
+	RB_EXPORT void bswapScalar(void const* src, void* dst, usize count, usize size) noexcept;
+#if RB_BYTE_ORDER_X86
+	RB_EXPORT void bswapSse2(void const* src, void* dst, usize count, usize size) noexcept;
+	RB_EXPORT void bswapSsse3(void const* src, void* dst, usize count, usize size) noexcept;
+	RB_EXPORT void bswapAvx2(void const* src, void* dst, usize count, usize size) noexcept;
+#elif RB_BYTE_ORDER_NEON
+	RB_EXPORT void bswapNeon(void const* src, void* dst, usize count, usize size) noexcept;
+#endif
+
+	template <Endian kOrder, class T>
+	void copy(void const* src, void* dst, usize count) noexcept {
+		if constexpr (kOrder != Endian::kNative && sizeof(T) > 1) {
+			bswapCopy(src, dst, count, sizeof(T));
+		} else if (count) {
+			std::memcpy(dst, src, count * sizeof(T));
+		}
+	}
+
+} // namespace impl::byteOrder
+
+template <class T>
+inline constexpr bool isByteSwappable = isArithmetic<RemoveCv<T>> && !isSame<RemoveCv<T>, bool>
+                                     && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+/// Reverses the bytes of every element of @p values, like bswap() does for a single value.
+template <class T, usize n,
+    RB_REQUIRES(isByteSwappable<T> && !isConst<T>)>
+void bswapInPlace(Span<T, n> values) noexcept {
+	if constexpr (sizeof(T) > 1) {
+		impl::byteOrder::bswapCopy(values.data(), values.data(), values.size(), sizeof(T));
+	}
+}
+
+/// Decodes @p values from big-endian @p bytes; @pre `bytes.size() == values.sizeBytes()`
+template <class T, usize n,
+    RB_REQUIRES(isByteSwappable<T> && !isConst<T>)>
+void loadBigEndian(ByteConstSpan bytes, Span<T, n> values) noexcept {
+	RB_ASSERT(bytes.size() == values.sizeBytes());
+	impl::byteOrder::copy<Endian::kBig, T>(bytes.data(), values.data(), values.size());
+}
+
+/// Decodes @p values from little-endian @p bytes; @pre `bytes.size() == values.sizeBytes()`
+template <class T, usize n,
+    RB_REQUIRES(isByteSwappable<T> && !isConst<T>)>
+void loadLittleEndian(ByteConstSpan bytes, Span<T, n> values) noexcept {
+	RB_ASSERT(bytes.size() == values.sizeBytes());
+	impl::byteOrder::copy<Endian::kLittle, T>(bytes.data(), values.data(), values.size());
+}
+
+/// Encodes @p values to big-endian @p bytes; @pre `bytes.size() == values.sizeBytes()`
+template <class T, usize n,
+    RB_REQUIRES(isByteSwappable<T>)>
+void storeBigEndian(Span<T, n> values, ByteSpan bytes) noexcept {
+	RB_ASSERT(bytes.size() == values.sizeBytes());
+	impl::byteOrder::copy<Endian::kBig, T>(values.data(), bytes.data(), values.size());
+}
+
+/// Encodes @p values to little-endian @p bytes; @pre `bytes.size() == values.sizeBytes()`
+template <class T, usize n,
+    RB_REQUIRES(isByteSwappable<T>)>
+void storeLittleEndian(Span<T, n> values, ByteSpan bytes) noexcept {
+	RB_ASSERT(bytes.size() == values.sizeBytes());
+	impl::byteOrder::copy<Endian::kLittle, T>(values.data(), bytes.data(), values.size());
+}
+
+} // namespace rb::core
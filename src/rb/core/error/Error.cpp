@@ -1,11 +1,87 @@
 #include "Error.hpp"
 
+#include <cstring>
+#include <new>
+
+#include <rb/core/exchange.hpp>
+#include <rb/core/memory/RcPtr.hpp>
+
 using namespace rb::core;
 using namespace rb::core::error;
 
+RB_WARNING_PUSH
+RB_WARNING_POSSIBLE_NULL_ARGUMENT
+
+impl::ErrorData* impl::ErrorData::make(std::string_view message, ErrorCause const* cause) {
+	void* const ptr = ::operator new(sizeof(ErrorData) + message.size() + 1);
+	auto* const data = ::new (ptr) ErrorData(cause);
+	auto* const chars = reinterpret_cast<char*>(data + 1); // NOLINT(*-reinterpret-cast)
+	if (!message.empty()) {
+		std::memcpy(chars, message.data(), message.size());
+	}
+	chars[message.size()] = '\0';
+	return data;
+}
+
+RB_WARNING_POP
+
+Error::Error(Error const& rhs) noexcept
+    : msg_(rhs.msg_)
+    , data_(rhs.data_)
+    , loc_(rhs.loc_) {
+	if (data_) {
+		data_->retain();
+	}
+}
+
+Error::Error(Error&& rhs) noexcept
+    : msg_(rhs.msg_)
+    , data_(rhs.data_)
+    , loc_(rhs.loc_) {
+	if (rhs.hasDynamicMessage()) {
+		rhs.msg_ = nullptr;
+	}
+	rhs.data_ = nullptr;
+}
+
+Error::~Error() {
+	if (data_) {
+		data_->release();
+	}
+}
+
+Error& Error::operator=(Error const& rhs) noexcept {
+	if (this != &rhs) {
+		if (rhs.data_) {
+			rhs.data_->retain();
+		}
+		setData(rhs.data_);
+		msg_ = rhs.msg_;
+		loc_ = rhs.loc_;
+	}
+	return *this;
+}
+
+Error& Error::operator=(Error&& rhs) noexcept {
+	if (this != &rhs) {
+		bool const dynamic = rhs.hasDynamicMessage();
+		setData(exchange(rhs.data_, nullptr));
+		msg_ = dynamic ? exchange(rhs.msg_, nullptr) : rhs.msg_;
+		loc_ = rhs.loc_;
+	}
+	return *this;
+}
+
+Error& Error::withMessage(std::string_view msg) & {
+	impl::ErrorData* const data = impl::ErrorData::make(msg, data_ ? data_->cause() : nullptr);
+	data->retain();
+	setData(data);
+	msg_ = data_->message();
+	return *this;
+}
+
 void Error::printTo(std::ostream& os) const {
 	os << *this;
-	/*
 	int level = 1;
 	Error const* cause = this->cause();
 	while (cause) {
@@ -17,7 +93,6 @@ void Error::printTo(std::ostream& os) const {
 		cause = cause->cause();
 		++level;
 	}
-	*/
 	os << std::endl;
 }
 
@@ -27,6 +102,25 @@ void Error::printMessage(std::ostream& os) const {
 	}
 }
 
+void Error::setCause(impl::ErrorCause* cause) {
+	RcPtr<impl::ErrorCause> const owner(cause);
+	// the block is immutable, so a dynamic message is copied into the new one
+	bool const dynamic = hasDynamicMessage();
+	impl::ErrorData* const data = impl::ErrorData::make(dynamic ? std::string_view(msg_) : std::string_view(), cause);
+	data->retain();
+	setData(data);
+	if (dynamic) {
+		msg_ = data_->message();
+	}
+}
+
+void Error::setData(impl::ErrorData const* data) noexcept {
+	if (data_) {
+		data_->release();
+	}
+	data_ = data;
+}
+
 std::ostream& error::operator<<(std::ostream& os, Error const& error) {
 	if (error.message()) {
 		error.printMessage(os);
@@ -1,15 +1,92 @@
 #pragma once
 
+#include <string_view>
+
+#include <rb/core/memory/RefCounted.hpp>
 #include <rb/core/move.hpp>
+#include <rb/core/requires.hpp>
 #include <rb/core/SourceLocation.hpp>
+#include <rb/core/traits/Decay.hpp>
+#include <rb/core/traits/IsBaseOf.hpp>
 #include <rb/core/warnings.hpp>
 
 namespace rb::core {
+inline namespace error {
+	class Error;
+} // namespace error
+
+namespace impl {
+
+	/// A type-erased cause of Error, which keeps the dynamic type of the cause.
+	class ErrorCause : public RefCounted<ErrorCause> {
+	public:
+		ErrorCause() noexcept = default;
+		ErrorCause(ErrorCause const&) = delete;
+		ErrorCause& operator=(ErrorCause const&) = delete;
+		virtual ~ErrorCause() = default;
+
+		virtual Error const& error() const noexcept = 0;
+	};
+
+	template <class E>
+	class ErrorCauseOf;
+
+	/**
+	 * The immutable part of Error which is shared by all its copies: the cause and a dynamic message.
+	 * The message characters follow the object in the same allocation.
+	 */
+	class RB_EXPORT ErrorData final : public RefCounted<ErrorData> {
+	public:
+		/// @return a new block with a copy of @p message, which retains @p cause
+		static ErrorData* make(std::string_view message, ErrorCause const* cause);
+
+		ErrorData(ErrorData const&) = delete;
+		ErrorData& operator=(ErrorData const&) = delete;
+
+		~ErrorData() {
+			if (cause_) {
+				cause_->release();
+			}
+		}
+
+		// the object is allocated with `::operator new` together with the message
+		static void operator delete(void* ptr) noexcept {
+			::operator delete(ptr);
+		}
+
+		czstring message() const noexcept {
+			return reinterpret_cast<czstring>(this + 1); // NOLINT(*-reinterpret-cast)
+		}
+
+		ErrorCause const* cause() const noexcept {
+			return cause_;
+		}
+
+	private:
+		explicit ErrorData(ErrorCause const* cause) noexcept
+		    : cause_(cause) {
+			if (cause_) {
+				cause_->retain();
+			}
+		}
+
+		ErrorCause const* cause_;
+	};
+
+} // namespace impl
+
 inline namespace error {
 
 	RB_WARNING_PUSH
 	RB_WARNING_PADDING
 
+	/**
+	 * The base class of errors.
+	 *
+	 * A static message is kept as a bare pointer, so such errors never allocate.
+	 * A dynamic message and the cause live in a single immutable ref-counted block,
+	 * so copying an error while it propagates costs at most one atomic increment.
+	 */
 	class RB_EXPORT Error {
 	public:
 		/// Construct Error with an empty message and specified @p location.
@@ -17,18 +94,24 @@ inline namespace error {
 		    : loc_{location} {
 		}
 
-		/// Construct Error with @p msg and @p location.
+		/// Construct Error with @p msg and @p location; @p msg must outlive the error, e.g. be a string literal.
 		constexpr explicit Error(czstring msg, RB_SOURCE_LOCATION_DECL) noexcept
 		    : msg_{msg}
 		    , loc_{location} {
 		}
 
-		constexpr Error(Error const&) noexcept = default;
-		constexpr Error(Error&&) noexcept = default;
-		virtual ~Error() = default;
+		/// Construct Error with a copy of @p msg and @p location.
+		explicit Error(std::string_view msg, RB_SOURCE_LOCATION_DECL)
+		    : loc_{location} {
+			withMessage(msg);
+		}
+
+		Error(Error const& rhs) noexcept;
+		Error(Error&& rhs) noexcept;
+		virtual ~Error();
 
-		Error& operator=(Error const&) noexcept = default;
-		Error& operator=(Error&& rhs) noexcept = default;
+		Error& operator=(Error const& rhs) noexcept;
+		Error& operator=(Error&& rhs) noexcept;
 
 		/// Initializes the source location of this error to the specified value.
 		/// @return @c *this.
@@ -37,25 +120,57 @@ inline namespace error {
 			return *this;
 		}
 
-		/// Initializes the description of this error to the specified value.
+		/// Initializes the description of this error to the specified value, which must outlive the error.
 		/// @return @c *this.
 		constexpr Error& withMessage(czstring msg) & noexcept {
 			msg_ = msg;
 			return *this;
 		}
 
-		/// Initializes the description of this error to the specified value.
+		/// Initializes the description of this error to the specified value, which must outlive the error.
 		/// @return @c *this.
 		constexpr Error&& withMessage(czstring msg) && noexcept {
 			msg_ = msg;
 			return RB_MOVE(*this);
 		}
 
+		/// Initializes the description of this error to a copy of the specified value.
+		/// @return @c *this.
+		Error& withMessage(std::string_view msg) &;
+
+		/// Initializes the description of this error to a copy of the specified value.
+		/// @return @c *this.
+		Error&& withMessage(std::string_view msg) && {
+			return RB_MOVE(withMessage(msg));
+		}
+
+		/// Initializes the cause of this error to a copy of @p cause, keeping its dynamic type.
+		/// @return @c *this.
+		template <class E,
+		    RB_REQUIRES(isBaseOf<Error, Decay<E>>)>
+		Error& withCause(E&& cause) & {
+			setCause(new impl::ErrorCauseOf<Decay<E>>(RB_FWD(cause)));
+			return *this;
+		}
+
+		/// Initializes the cause of this error to a copy of @p cause, keeping its dynamic type.
+		/// @return @c *this.
+		template <class E,
+		    RB_REQUIRES(isBaseOf<Error, Decay<E>>)>
+		Error&& withCause(E&& cause) && {
+			return RB_MOVE(withCause(RB_FWD(cause)));
+		}
+
 		/// @return string description of @c this.
 		constexpr czstring message() const noexcept {
 			return msg_;
 		}
 
+		/// @return the error which caused @c this, or @c nullptr.
+		Error const* cause() const noexcept {
+			return data_ && data_->cause() ? &data_->cause()->error() : nullptr;
+		}
+
 		/// @return location of @c this in source code.
 		constexpr SourceLocation const& location() const noexcept {
 			return loc_;
@@ -70,7 +185,18 @@ inline namespace error {
 	private:
 		friend std::ostream& operator<<(std::ostream& os, Error const& error);
 
-		czstring msg_ = nullptr;
+		/// Takes the ownership of the fresh @p cause.
+		void setCause(impl::ErrorCause* cause);
+
+		/// Replaces the block with the already retained @p data.
+		void setData(impl::ErrorData const* data) noexcept;
+
+		bool hasDynamicMessage() const noexcept {
+			return data_ && msg_ == data_->message();
+		}
+
+		czstring msg_ = nullptr; // either static or owned by `data_`
+		impl::ErrorData const* data_ = nullptr;
 		SourceLocation loc_;
 	};
 
@@ -79,4 +205,25 @@ inline namespace error {
 	std::ostream& operator<<(std::ostream& os, Error const& error);
 
 } // namespace error
+
+namespace impl {
+
+	template <class E>
+	class ErrorCauseOf final : public ErrorCause {
+	public:
+		template <class Arg>
+		explicit ErrorCauseOf(Arg&& error)
+		    : error_(RB_FWD(error)) {
+		}
+
+		Error const& error() const noexcept override {
+			return error_;
+		}
+
+	private:
+		E error_;
+	};
+
+} // namespace impl
+
 } // namespace rb::core
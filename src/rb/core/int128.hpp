@@ -8,8 +8,10 @@
 
 #include <rb/core/assert.hpp>
 #include <rb/core/bits.hpp>
+#include <rb/core/builtins.hpp>
 #include <rb/core/error/RangeError.hpp>
 #include <rb/core/limits.hpp>
+#include <rb/core/processor.hpp>
 #include <rb/core/quorem.hpp>
 #include <rb/core/traits/IsSigned.hpp>
 #include <rb/core/traits/IsUnsigned.hpp>
@@ -24,6 +26,114 @@ namespace rb::core {
 	RB_UNREACHABLE_ASSERT();
 }
 
+namespace impl::int128 {
+
+#ifdef __SIZEOF_INT128__
+	#define RB_HAS_NATIVE_INT128 1
+	__extension__ typedef unsigned __int128 Native; // NOLINT(modernize-use-using)
+#else
+	#define RB_HAS_NATIVE_INT128 0
+#endif
+
+	/// @return the low half of the full product of @p lhs and @p rhs; the high half is stored to @p hi.
+	RB_ALWAYS_INLINE constexpr u64 mulWide(u64 lhs, u64 rhs, u64& hi) noexcept {
+#if RB_HAS_NATIVE_INT128
+		Native const product = Native{lhs} * rhs;
+		hi = static_cast<u64>(product >> 64);
+		return static_cast<u64>(product);
+#else
+	#if defined(RB_COMPILER_MSVC) && defined(RB_PROCESSOR_X86_64)
+		if (!RB_IS_CONSTANT_EVALUATED()) {
+			return _umul128(lhs, rhs, &hi);
+		}
+	#elif defined(RB_COMPILER_MSVC) && defined(RB_PROCESSOR_ARM_64)
+		if (!RB_IS_CONSTANT_EVALUATED()) {
+			hi = __umulh(lhs, rhs);
+			return lhs * rhs;
+		}
+	#endif
+		u64 const a32 = lhs >> 32;
+		u64 const a00 = lhs & 0xffff'ffff;
+		u64 const b32 = rhs >> 32;
+		u64 const b00 = rhs & 0xffff'ffff;
+		u64 const mid = (a00 * b00 >> 32) + (a32 * b00 & 0xffff'ffff) + a00 * b32;
+		hi = a32 * b32 + (a32 * b00 >> 32) + (mid >> 32);
+		return lhs * rhs;
+#endif
+	}
+
+	/// Knuth's algorithm D for a two-digit dividend in base 2^32, see "Hacker's Delight", divlu.
+	constexpr u64 divWideKnuth(u64 hi, u64 lo, u64 divisor, u64& rem) noexcept {
+		constexpr u64 kBase = u64{1} << 32;
+		constexpr u64 kMask = kBase - 1;
+
+		// normalize, so the high digit of the divisor has its MSB set and estimates are off by at most 2
+		unsigned const shift = countLeadingZeroes(divisor);
+		divisor <<= shift;
+		u64 const vn1 = divisor >> 32;
+		u64 const vn0 = divisor & kMask;
+		u64 const un32 = shift ? (hi << shift) | (lo >> (64 - shift)) : hi;
+		u64 const un10 = lo << shift;
+		u64 const un1 = un10 >> 32;
+		u64 const un0 = un10 & kMask;
+
+		u64 q1 = un32 / vn1;
+		u64 rhat = un32 - q1 * vn1;
+		while (q1 >= kBase || q1 * vn0 > ((rhat << 32) | un1)) {
+			--q1;
+			rhat += vn1;
+			if (rhat >= kBase) {
+				break;
+			}
+		}
+
+		u64 const un21 = (un32 << 32) + un1 - q1 * divisor;
+		u64 q0 = un21 / vn1;
+		rhat = un21 - q0 * vn1;
+		while (q0 >= kBase || q0 * vn0 > ((rhat << 32) | un0)) {
+			--q0;
+			rhat += vn1;
+			if (rhat >= kBase) {
+				break;
+			}
+		}
+
+		rem = ((un21 << 32) + un0 - q0 * divisor) >> shift;
+		return (q1 << 32) | q0;
+	}
+
+#if defined(RB_COMPILER_GCC_LIKE) && defined(RB_PROCESSOR_X86_64)
+	// asm isn't allowed in constexpr functions
+	RB_ALWAYS_INLINE u64 divq(u64 hi, u64 lo, u64 divisor, u64& rem) noexcept {
+		u64 quo = 0;
+		__asm__("divq %[divisor]"
+		        : "=a"(quo), "=d"(rem)
+		        : [divisor] "rm"(divisor), "a"(lo), "d"(hi));
+		return quo;
+	}
+#endif
+
+	/**
+	 * Divides the 128-bit value `hi:lo` by @p divisor, which is a single `div` instruction on x86-64.
+	 * @pre `hi < divisor`, i.e. the quotient fits into 64 bits
+	 * @return the quotient; the remainder is stored to @p rem.
+	 */
+	RB_ALWAYS_INLINE constexpr u64 divWide(u64 hi, u64 lo, u64 divisor, u64& rem) noexcept {
+		RB_DEBUG_ASSERT(hi < divisor);
+#if defined(RB_COMPILER_GCC_LIKE) && defined(RB_PROCESSOR_X86_64)
+		if (!RB_IS_CONSTANT_EVALUATED()) {
+			return divq(hi, lo, divisor, rem);
+		}
+#elif defined(RB_COMPILER_MSVC) && defined(RB_PROCESSOR_X86_64) && _MSC_VER >= 1920
+		if (!RB_IS_CONSTANT_EVALUATED()) {
+			return _udiv128(hi, lo, divisor, &rem);
+		}
+#endif
+		return divWideKnuth(hi, lo, divisor, rem);
+	}
+
+} // namespace impl::int128
+
 template <bool kUnsigned>
 class alignas(sizeof(usize) * 2) Int128 final {
 	template <bool>
@@ -242,14 +352,10 @@ public:
 
 	template <bool _ = true, RB_REQUIRES(_&& kUnsigned)>
 	constexpr Int128 operator*(Int128 rhs) const noexcept {
-		auto const a32 = lo_ >> 32;
-		auto const a00 = lo_ & 0xffffffff;
-		auto const b32 = rhs.lo_ >> 32;
-		auto const b00 = rhs.lo_ & 0xffffffff;
-		Int128 result{hi_ * rhs.lo_ + lo_ * rhs.hi_ + a32 * b32, a00 * b00};
-		result += Int128{a32 * b00} << 32;
-		result += Int128{a00 * b32} << 32;
-		return result;
+		// the high halves contribute only to the high half of the result
+		u64 hi = 0;
+		u64 const lo = impl::int128::mulWide(lo_, rhs.lo_, hi);
+		return {hi + hi_ * rhs.lo_ + lo_ * rhs.hi_, lo};
 	}
 
 	template <bool _ = true, RB_REQUIRES(_ && !kUnsigned)>
@@ -457,36 +563,54 @@ constexpr void divMod(u128 dividend, u128 divisor, u128& quo, u128& rem) noexcep
 		raiseFpe();
 	}
 
-	if (divisor > dividend) {
-		quo = 0;
-		rem = dividend;
-		return;
-	}
+	auto const dividendHi = static_cast<u64>(dividend >> 64);
+	auto const dividendLo = static_cast<u64>(dividend);
+	auto const divisorHi = static_cast<u64>(divisor >> 64);
+	auto const divisorLo = static_cast<u64>(divisor);
 
-	if (divisor == dividend) {
-		quo = 1;
-		rem = 0;
-		return;
-	}
-
-	u128 denominator = divisor;
-	u128 quotient;
-	// left aligns the MSB of the denominator and the dividend
-	unsigned const shift = fls128(dividend) - fls128(denominator);
-	denominator <<= static_cast<int>(shift);
-	// Uses shift-subtract algorithm to divide dividend by denominator.
-	// The remainder will be left in dividend
-	for (unsigned i = 0; i <= shift; ++i) {
-		quotient <<= 1;
-		if (dividend >= denominator) {
-			dividend -= denominator;
-			quotient |= 1;
+	// the common case of a 64-bit divisor: at most two hardware divisions
+	if (!divisorHi) {
+		u64 quoHi = 0;
+		u64 hi = dividendHi;
+		if (hi >= divisorLo) {
+			quoHi = hi / divisorLo;
+			hi %= divisorLo;
 		}
-		denominator >>= 1;
+		u64 remLo = 0;
+		u64 const quoLo = impl::int128::divWide(hi, dividendLo, divisorLo, remLo);
+		quo = (u128{quoHi} << 64) | quoLo;
+		rem = remLo;
+		return;
 	}
 
-	quo = quotient;
-	rem = dividend;
+#if RB_HAS_NATIVE_INT128
+	using impl::int128::Native;
+	Native const n = (Native{dividendHi} << 64) | dividendLo;
+	Native const d = (Native{divisorHi} << 64) | divisorLo;
+	Native const q = n / d;
+	Native const r = n % d;
+	quo = (u128{static_cast<u64>(q >> 64)} << 64) | static_cast<u64>(q);
+	rem = (u128{static_cast<u64>(r >> 64)} << 64) | static_cast<u64>(r);
+#else
+	// the quotient fits into 64 bits, it's estimated from the normalized high half of the divisor
+	// and is off by at most one, see "Hacker's Delight", divu128
+	unsigned const shift = countLeadingZeroes(divisorHi);
+	auto const normalized = static_cast<u64>((divisor << static_cast<int>(shift)) >> 64);
+	u128 const half = dividend >> 1;
+	u64 unused = 0;
+	u64 const estimate = impl::int128::divWide(static_cast<u64>(half >> 64), static_cast<u64>(half), normalized, unused);
+	// undo the normalization and the halving of the dividend
+	auto q = static_cast<u64>((u128{estimate} << static_cast<int>(shift)) >> 63);
+	if (q) {
+		--q;
+	}
+	rem = dividend - divisor * q;
+	if (rem >= divisor) {
+		++q;
+		rem -= divisor;
+	}
+	quo = q;
+#endif
 }
 
 template <bool kUnsigned>
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <rb/core/memory/AllocatorTraits.hpp>
+#include <rb/core/memory/EmptyBase.hpp>
+#include <rb/core/memory/OwnerPtr.hpp>
+#include <rb/core/memory/toAddress.hpp>
+#include <rb/core/memory/UniquePtr.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	/**
+	 * Deleter which destroys and deallocates an object through @p Alloc.
+	 * A stateless allocator takes no space, so the owning UniquePtr stays as wide as a raw pointer.
+	 */
+	template <class Alloc>
+	class AllocDeleter : EmptyBase<Alloc> {
+		using Super = EmptyBase<Alloc>;
+		using Traits = AllocatorTraits<Alloc>;
+
+	public:
+		using Pointer = typename Traits::Pointer;
+		using Allocator = Alloc;
+
+		constexpr AllocDeleter() noexcept(isNothrowDefaultConstructible<Alloc>) = default;
+
+		constexpr explicit AllocDeleter(Alloc const& a) noexcept(isNothrowCopyConstructible<Alloc>)
+		    : Super(a) {
+		}
+
+		constexpr explicit AllocDeleter(Alloc&& a) noexcept(isNothrowMoveConstructible<Alloc>)
+		    : Super(RB_MOVE(a)) {
+		}
+
+		void operator()(Pointer ptr) noexcept {
+			Traits::destroy(allocator(), toAddress(ptr));
+			Traits::deallocate(allocator(), ptr, 1);
+		}
+
+		constexpr Alloc const& allocator() const noexcept {
+			return Super::get();
+		}
+
+		constexpr Alloc& allocator() noexcept {
+			return Super::get();
+		}
+
+	private:
+		template <class T, class A, class... Args>
+		friend auto makeUniqueWithAllocator(A const& alloc, Args&&... args)
+		    -> UniquePtr<T, AllocDeleter<typename AllocatorTraits<A>::template RebindAlloc<T>>>;
+
+		template <class... Args>
+		static UniquePtr<typename Traits::Value, AllocDeleter> make(Alloc a, Args&&... args) {
+			Pointer ptr = Traits::allocate(a, 1);
+			try {
+				Traits::construct(a, toAddress(ptr), RB_FWD(args)...);
+			} catch (...) {
+				Traits::deallocate(a, ptr, 1);
+				throw;
+			}
+			return UniquePtr<typename Traits::Value, AllocDeleter>(ptr, AllocDeleter(RB_MOVE(a)));
+		}
+	};
+
+	/// UniquePtr to an object allocated by (a rebound copy of) @p Alloc.
+	template <class T, class Alloc>
+	using AllocUniquePtr = UniquePtr<T, AllocDeleter<typename AllocatorTraits<Alloc>::template RebindAlloc<T>>>;
+
+	/// Allocates and constructs an object of type @p T using a copy of @p alloc rebound to @p T.
+	/// @return UniquePtr whose deleter destroys and deallocates the object through the same allocator.
+	template <class T, class A, class... Args>
+	auto makeUniqueWithAllocator(A const& alloc, Args&&... args)
+	    -> UniquePtr<T, AllocDeleter<typename AllocatorTraits<A>::template RebindAlloc<T>>> {
+		static_assert(isConstructible<T, Args...>, "T must be constructible from Args");
+		using Rebound = typename AllocatorTraits<A>::template RebindAlloc<T>;
+		return AllocDeleter<Rebound>::make(Rebound(alloc), RB_FWD(args)...);
+	}
+
+	/// Same as makeUniqueWithAllocator(), but the allocator is type-erased.
+	template <class T, class A, class... Args>
+	OwnerPtr<T> makeOwnerWithAllocator(A const& alloc, Args&&... args) {
+		return makeUniqueWithAllocator<T>(alloc, RB_FWD(args)...);
+	}
+
+} // namespace memory
+} // namespace rb::core
@@ -0,0 +1,168 @@
+#include "AllocationTracker.hpp"
+
+#include <atomic>
+
+#include <rb/core/memory/CachePadded.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+RB_WARNING_PUSH
+RB_WARNING_PADDING
+
+struct CallSiteEntry {
+	SourceLocation location;
+	usize allocations = 0;
+	usize bytes = 0;
+	bool used = false;
+};
+
+struct CallSitesLock {
+	std::atomic_flag flag = ATOMIC_FLAG_INIT;
+};
+
+RB_WARNING_POP
+
+// every counter gets its own cache line, so threads bumping different ones (e.g. distinct size classes) don't collide
+CachePadded<std::atomic<usize>> allocations{0};
+CachePadded<std::atomic<usize>> deallocations{0};
+CachePadded<std::atomic<usize>> liveBytes{0};
+CachePadded<std::atomic<usize>> peakBytes{0};
+CachePadded<std::atomic<usize>> sizeClasses[AllocationTracker::kSizeClasses];
+
+// the call-site table is only touched by located records, so contention is limited to TrackingAllocator users
+CachePadded<CallSitesLock> callSitesLock;
+CallSiteEntry callSites[AllocationTracker::kMaxCallSites];
+
+thread_local usize threadAllocations = 0;
+thread_local usize pauseDepth = 0;
+thread_local SourceLocation const* scopeLocation = nullptr;
+
+class CallSitesLocker final {
+public:
+	CallSitesLocker() noexcept {
+		while (callSitesLock->flag.test_and_set(std::memory_order_acquire)) {
+		}
+	}
+
+	~CallSitesLocker() {
+		callSitesLock->flag.clear(std::memory_order_release);
+	}
+
+	RB_DISABLE_COPY_MOVE(CallSitesLocker)
+};
+
+bool isEmpty(SourceLocation const& location) noexcept {
+	return location.line() == 0 && !location.file()[0];
+}
+
+bool isSame(SourceLocation const& lhs, SourceLocation const& rhs) noexcept {
+	// `file()` and `func()` point to string literals, so pointer comparison is enough in practice
+	return lhs.line() == rhs.line() && lhs.column() == rhs.column() && lhs.file() == rhs.file();
+}
+
+void recordCallSite(usize bytes, SourceLocation const& location) noexcept {
+	CallSitesLocker const locker;
+	for (auto& entry : callSites) {
+		if (!entry.used) {
+			entry.location = location;
+			entry.used = true;
+		} else if (!isSame(entry.location, location)) {
+			continue;
+		}
+		++entry.allocations;
+		entry.bytes += bytes;
+		return;
+	}
+}
+
+} // namespace
+
+AllocationTracker::Pause::Pause() noexcept {
+	++pauseDepth;
+}
+
+AllocationTracker::Pause::~Pause() {
+	--pauseDepth;
+}
+
+AllocationTracker::Scope::Scope(SourceLocation const& location) noexcept
+    : location_(location)
+    , outer_(scopeLocation) {
+	scopeLocation = &location_;
+}
+
+AllocationTracker::Scope::~Scope() {
+	scopeLocation = outer_;
+}
+
+AllocationTracker& AllocationTracker::global() noexcept {
+	static AllocationTracker tracker;
+	return tracker;
+}
+
+usize AllocationTracker::threadAllocations() noexcept {
+	return ::threadAllocations;
+}
+
+void AllocationTracker::recordAllocation(usize bytes, SourceLocation const& location) noexcept {
+	if (pauseDepth > 0) {
+		return;
+	}
+
+	++::threadAllocations;
+	allocations->fetch_add(1, std::memory_order_relaxed);
+	sizeClasses[sizeClassOf(bytes)]->fetch_add(1, std::memory_order_relaxed);
+	usize const live = liveBytes->fetch_add(bytes, std::memory_order_relaxed) + bytes;
+	usize peak = peakBytes->load(std::memory_order_relaxed);
+	while (live > peak && !peakBytes->compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+	}
+	SourceLocation const& site = scopeLocation ? *scopeLocation : location;
+	if (!isEmpty(site)) {
+		recordCallSite(bytes, site);
+	}
+}
+
+void AllocationTracker::recordDeallocation(usize bytes) noexcept {
+	if (pauseDepth > 0) {
+		return;
+	}
+
+	deallocations->fetch_add(1, std::memory_order_relaxed);
+	liveBytes->fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+AllocationTracker::Snapshot AllocationTracker::snapshot() const noexcept {
+	Snapshot result{};
+	result.allocations = allocations->load(std::memory_order_relaxed);
+	result.deallocations = deallocations->load(std::memory_order_relaxed);
+	result.liveBytes = liveBytes->load(std::memory_order_relaxed);
+	result.peakBytes = peakBytes->load(std::memory_order_relaxed);
+	for (usize i = 0; i < kSizeClasses; ++i) {
+		result.sizeClasses[i] = sizeClasses[i]->load(std::memory_order_relaxed);
+	}
+
+	CallSitesLocker const locker;
+	for (auto const& entry : callSites) {
+		if (!entry.used) {
+			break;
+		}
+		result.callSites[result.callSiteCount++] = {entry.location, entry.allocations, entry.bytes};
+	}
+	return result;
+}
+
+void AllocationTracker::reset() noexcept {
+	allocations->store(0, std::memory_order_relaxed);
+	deallocations->store(0, std::memory_order_relaxed);
+	peakBytes->store(liveBytes->load(std::memory_order_relaxed), std::memory_order_relaxed);
+	for (auto& cls : sizeClasses) {
+		cls->store(0, std::memory_order_relaxed);
+	}
+
+	CallSitesLocker const locker;
+	for (auto& entry : callSites) {
+		entry = {};
+	}
+}
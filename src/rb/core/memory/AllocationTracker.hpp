@@ -0,0 +1,119 @@
+#pragma once
+
+#include <rb/core/export.hpp>
+#include <rb/core/helpers.hpp>
+#include <rb/core/invoke.hpp>
+#include <rb/core/SourceLocation.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	RB_WARNING_PUSH
+	RB_WARNING_PADDING
+
+	/**
+	 * Process-wide allocation statistics: counts, live and peak bytes, a size-class histogram
+	 * and per-call-site totals.
+	 *
+	 * Fed by TrackingAllocator and, if the `Rb::AllocationHooks` target is linked,
+	 * by the replaced global `operator new`/`operator delete`.
+	 * Recording never allocates.
+	 */
+	class RB_EXPORT AllocationTracker final {
+	public:
+		/// Size class `i` holds requests of up to `16 << i` bytes; the last class holds everything larger.
+		static constexpr usize kSizeClasses = 16;
+
+		/// Capacity of the call-site table; allocations from further sites are counted but not attributed.
+		static constexpr usize kMaxCallSites = 64;
+
+		struct CallSite {
+			SourceLocation location;
+			usize allocations;
+			usize bytes;
+		};
+
+		struct Snapshot {
+			usize allocations;
+			usize deallocations;
+			usize liveBytes;
+			usize peakBytes;
+			usize sizeClasses[kSizeClasses];
+			usize callSiteCount;
+			CallSite callSites[kMaxCallSites];
+		};
+
+		/// While alive, allocations made by the calling thread are not recorded;
+		/// used by wrappers which record themselves on top of a tracked allocator.
+		class RB_EXPORT Pause final {
+		public:
+			Pause() noexcept;
+			~Pause();
+
+			RB_DISABLE_COPY_MOVE(Pause)
+		};
+
+		/**
+		 * While alive, allocations recorded on the calling thread are attributed to the place the scope was created at,
+		 * instead of the location passed to recordAllocation(); the innermost scope wins.
+		 * Containers allocate through AllocatorTraits, so this is how container operations get distinct call sites:
+		 * @code
+		 * AllocationTracker::Scope const scope;
+		 * vector.reserve(n);
+		 * @endcode
+		 */
+		class RB_EXPORT Scope final {
+		public:
+			explicit Scope(RB_SOURCE_LOCATION_DECL) noexcept;
+			~Scope();
+
+			RB_DISABLE_COPY_MOVE(Scope)
+
+		private:
+			SourceLocation location_;
+			SourceLocation const* outer_;
+		};
+
+		static AllocationTracker& global() noexcept;
+
+		/// @return index of the size class @p bytes falls into.
+		static constexpr usize sizeClassOf(usize bytes) noexcept {
+			usize cls = 0;
+			for (usize limit = 16; cls + 1 < kSizeClasses && bytes > limit; limit <<= 1) {
+				++cls;
+			}
+			return cls;
+		}
+
+		/// @return number of allocations recorded on the calling thread so far.
+		static usize threadAllocations() noexcept;
+
+		/// Records an allocation of @p bytes; it is attributed to the innermost Scope, or to @p location unless it is empty.
+		/// Does nothing if the calling thread is paused.
+		void recordAllocation(usize bytes, SourceLocation const& location = {}) noexcept;
+
+		/// Records a deallocation of @p bytes. Does nothing if the calling thread is paused.
+		void recordDeallocation(usize bytes) noexcept;
+
+		Snapshot snapshot() const noexcept;
+
+		/// Zeroes all counters except live bytes.
+		void reset() noexcept;
+
+	private:
+		AllocationTracker() noexcept = default;
+	};
+
+	RB_WARNING_POP
+
+	/// @return number of tracked allocations performed by the calling thread while running @p f.
+	template <class F>
+	usize allocationsDuring(F&& f) {
+		usize const before = AllocationTracker::threadAllocations();
+		invoke(RB_FWD(f));
+		return AllocationTracker::threadAllocations() - before;
+	}
+
+} // namespace memory
+} // namespace rb::core
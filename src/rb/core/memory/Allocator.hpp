@@ -14,6 +14,16 @@ inline namespace memory {
 		using Size = usize;
 		using Difference = isize;
 
+		constexpr Allocator() noexcept = default;
+		constexpr Allocator(Allocator const&) noexcept = default;
+
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		template <class U>
+		constexpr Allocator(Allocator<U> const& /*rhs*/) noexcept { // NOLINT(google-explicit-constructor)
+		}
+
+		constexpr Allocator& operator=(Allocator const&) noexcept = default;
+
 		[[nodiscard]] constexpr T* allocate(Size n) {
 			RB_CHECK_COMPLETENESS(T);
 			return static_cast<T*>(operator new(n * sizeof(Value)));
@@ -29,5 +39,15 @@ inline namespace memory {
 		}
 	};
 
+	template <class T, class U>
+	constexpr bool operator==(Allocator<T> const& /*lhs*/, Allocator<U> const& /*rhs*/) noexcept {
+		return true;
+	}
+
+	template <class T, class U>
+	constexpr bool operator!=(Allocator<T> const& /*lhs*/, Allocator<U> const& /*rhs*/) noexcept {
+		return false;
+	}
+
 } // namespace memory
 } // namespace rb::core
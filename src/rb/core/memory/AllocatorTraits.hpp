@@ -1,10 +1,15 @@
 #pragma once
 
+#include <cstring>
+
+#include <rb/core/assert.hpp>
 #include <rb/core/limits.hpp>
 #include <rb/core/memory/AllocationResult.hpp>
 #include <rb/core/memory/construct.hpp>
 #include <rb/core/memory/destroy.hpp>
 #include <rb/core/memory/PointerTraits.hpp>
+#include <rb/core/memory/toAddress.hpp>
+#include <rb/core/swap.hpp>
 #include <rb/core/traits/builtins.hpp>
 #include <rb/core/traits/Unsigned.hpp>
 
@@ -18,8 +23,12 @@ namespace impl {
 	RB_TYPE_DETECTOR(ConstVoidPointer)
 	RB_TYPE_DETECTOR(Size)
 	RB_TYPE_DETECTOR(IsAlwaysEqual)
+	RB_TYPE_DETECTOR(PropagateOnContainerCopyAssignment)
+	RB_TYPE_DETECTOR(PropagateOnContainerMoveAssignment)
+	RB_TYPE_DETECTOR(PropagateOnContainerSwap)
 	RB_METHOD_DETECTOR_NAME(allocate, AllocateMethod)
 	RB_METHOD_DETECTOR_NAME(allocateAtLeast, AllocateAtLeastMethod)
+	RB_METHOD_DETECTOR_NAME(allocateZeroed, AllocateZeroedMethod)
 	RB_METHOD_DETECTOR_NAME(construct, ConstructMethod)
 	RB_METHOD_DETECTOR_NAME(destroy, DestroyMethod)
 	RB_METHOD_DETECTOR_NAME(maxSize, MaxSizeMethod)
@@ -70,6 +79,11 @@ inline namespace memory {
 		using Difference = DetectedOrType<typename PT::Difference, impl::DifferenceDetector, Alloc>;
 		using Size = DetectedOrType<Unsigned<Difference>, impl::SizeDetector, Alloc>;
 		using IsAlwaysEqual = DetectedOrType<IsEmpty<Alloc>, impl::IsAlwaysEqualDetector, Alloc>;
+		using PropagateOnContainerCopyAssignment =
+		    DetectedOrType<False, impl::PropagateOnContainerCopyAssignmentDetector, Alloc>;
+		using PropagateOnContainerMoveAssignment =
+		    DetectedOrType<False, impl::PropagateOnContainerMoveAssignmentDetector, Alloc>;
+		using PropagateOnContainerSwap = DetectedOrType<False, impl::PropagateOnContainerSwapDetector, Alloc>;
 
 		template <class T>
 		using RebindAlloc = typename impl::RebindAllocImpl<Alloc, T>::Type;
@@ -98,6 +112,19 @@ inline namespace memory {
 			}
 		}
 
+		/// Allocates storage for @p n objects with all bytes set to zero.
+		/// Allocators which know their memory is zero-filled (e.g. fresh OS mappings) provide `allocateZeroed(n)`,
+		/// so the block isn't touched; otherwise the block is cleared explicitly.
+		[[nodiscard]] static Pointer allocateZeroed(Alloc& a, Size n) {
+			if constexpr (isDetectedConvertible<Pointer, impl::AllocateZeroedMethodDetector, Alloc, Size>) {
+				return a.allocateZeroed(n);
+			} else {
+				Pointer const ptr = a.allocate(n);
+				std::memset(static_cast<void*>(toAddress(ptr)), 0, n * sizeof(Value));
+				return ptr;
+			}
+		}
+
 		template <class T, class... Args>
 		static constexpr void construct(Alloc& a, T* ptr, Args&&... args) {
 			if constexpr (impl::HasConstructMethod<Alloc, T*, Args...>::value) {
@@ -124,6 +151,26 @@ inline namespace memory {
 			}
 		}
 
+		/// @return whether the memory allocated by either of the allocators can be deallocated by the other one
+		static constexpr bool equal(Alloc const& lhs, Alloc const& rhs) {
+			if constexpr (IsAlwaysEqual::value) {
+				return true;
+			} else {
+				return lhs == rhs;
+			}
+		}
+
+		/// Swaps the allocators of two containers which swap their contents if the allocator propagates on swap;
+		/// otherwise each container keeps its allocator, so they must be equal.
+		static constexpr void swapOnContainerSwap(Alloc& lhs, Alloc& rhs) noexcept {
+			if constexpr (PropagateOnContainerSwap::value) {
+				using core::swap;
+				swap(lhs, rhs);
+			} else if constexpr (!IsAlwaysEqual::value) {
+				RB_ASSERT_MSG("containers with unequal allocators can't be swapped", lhs == rhs);
+			}
+		}
+
 		static constexpr Size maxSize(Alloc const& a) noexcept {
 			if constexpr (impl::HasMaxSizeMethod<Alloc>::value) {
 				return a.maxSize();
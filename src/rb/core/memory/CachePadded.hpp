@@ -0,0 +1,82 @@
+#pragma once
+
+#include <rb/core/InPlace.hpp>
+#include <rb/core/move.hpp>
+#include <rb/core/processor.hpp>
+#include <rb/core/traits/IsSame.hpp>
+#include <rb/core/traits/remove.hpp>
+#include <rb/core/traits/requirements.hpp>
+#include <rb/core/types.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	/// Minimum offset between two objects written by different threads to avoid false sharing.
+	inline constexpr usize kHardwareDestructiveInterferenceSize = RB_DESTRUCTIVE_INTERFERENCE_SIZE;
+
+	/// Maximum size of contiguous memory which is guaranteed to share a cache line (true sharing).
+	inline constexpr usize kHardwareConstructiveInterferenceSize = RB_CONSTRUCTIVE_INTERFERENCE_SIZE;
+
+	RB_WARNING_PUSH
+	RB_WARNING_PADDING
+
+	/**
+	 * CachePadded aligns and pads a value to #kHardwareDestructiveInterferenceSize,
+	 * so it never shares a cache line with another object.
+	 * Use it for data written by different threads, e.g. per-thread counters or the head and tail of a queue.
+	 */
+	template <class T>
+	class alignas(kHardwareDestructiveInterferenceSize) CachePadded final {
+	public:
+		using Value = T;
+
+		template <bool _ = true, RB_REQUIRES(_&& isDefaultConstructible<T>)>
+		constexpr CachePadded() noexcept(isNothrowDefaultConstructible<T>)
+		    : value_() {
+		}
+
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		template <class U = T,
+		    RB_REQUIRES(!isSame<RemoveCvRef<U>, CachePadded> && !isSame<RemoveCvRef<U>, InPlace> && isConstructible<T, U&&>)>
+		constexpr CachePadded(U&& value) noexcept(isNothrowConstructible<T, U&&>) // NOLINT(google-explicit-constructor)
+		    : value_(RB_FWD(value)) {
+		}
+
+		template <class... Args>
+		constexpr explicit CachePadded(InPlace /*inPlace*/, Args&&... args) noexcept(isNothrowConstructible<T, Args&&...>)
+		    : value_(RB_FWD(args)...) {
+		}
+
+		constexpr T const& get() const noexcept {
+			return value_;
+		}
+
+		constexpr T& get() noexcept {
+			return value_;
+		}
+
+		constexpr T const& operator*() const noexcept {
+			return value_;
+		}
+
+		constexpr T& operator*() noexcept {
+			return value_;
+		}
+
+		constexpr T const* operator->() const noexcept {
+			return &value_;
+		}
+
+		constexpr T* operator->() noexcept {
+			return &value_;
+		}
+
+	private:
+		T value_;
+	};
+
+	RB_WARNING_POP
+
+} // namespace memory
+} // namespace rb::core
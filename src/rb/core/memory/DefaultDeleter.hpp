@@ -6,6 +6,7 @@
 #include <rb/core/traits/IsFunction.hpp>
 #include <rb/core/traits/IsPointer.hpp>
 #include <rb/core/traits/IsVoid.hpp>
+#include <rb/core/types.hpp>
 
 namespace rb::core {
 inline namespace memory {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <rb/core/InPlace.hpp>
 #include <rb/core/memory/Wrapper.hpp>
 #include <rb/core/traits/builtins.hpp>
 
@@ -20,6 +21,12 @@ inline namespace memory {
 		    : T(RB_MOVE(value)) {
 		}
 
+		template <class... Args,
+		    RB_REQUIRES(isConstructible<T, Args...>)>
+		constexpr explicit EmptyBase(InPlace /*kInPlace*/, Args&&... args) noexcept(isNothrowConstructible<T, Args...>)
+		    : T(RB_FWD(args)...) {
+		}
+
 		constexpr T& get() & noexcept {
 			return *this;
 		}
@@ -38,11 +45,17 @@ inline namespace memory {
 	};
 
 	template <class T, int tag>
-	class EmptyBase<T, tag, false> : public Wrapper<T> {
-		using Super = Wrapper<T>;
+	class EmptyBase<T, tag, false> : public Wrapper<T, tag> {
+		using Super = Wrapper<T, tag>;
 
 	public:
 		using Super::Super;
+
+		template <class... Args,
+		    RB_REQUIRES(isConstructible<T, Args...>)>
+		constexpr explicit EmptyBase(InPlace /*kInPlace*/, Args&&... args) noexcept(isNothrowConstructible<T, Args...>)
+		    : Super(RB_FWD(args)...) {
+		}
 	};
 
 } // namespace memory
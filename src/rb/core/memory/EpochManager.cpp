@@ -0,0 +1,268 @@
+#include "EpochManager.hpp"
+
+#include <rb/core/assert.hpp>
+#include <rb/core/exchange.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+struct Retired {
+	void* ptr;
+	void (*deleter)(void*);
+};
+
+// the state word of a participant: `epoch << 1 | 1` while pinned, 0 otherwise
+constexpr u64 kPinned = 1;
+
+class SpinLocker final {
+public:
+	explicit SpinLocker(std::atomic_flag& flag) noexcept
+	    : flag_(flag) {
+		while (flag_.test_and_set(std::memory_order_acquire)) {
+		}
+	}
+
+	~SpinLocker() {
+		flag_.clear(std::memory_order_release);
+	}
+
+	RB_DISABLE_COPY_MOVE(SpinLocker)
+
+private:
+	std::atomic_flag& flag_;
+};
+
+} // namespace
+
+RB_WARNING_PUSH
+RB_WARNING_PADDING
+
+struct EpochManager::Bag final {
+	Retired items[kBatchSize];
+	usize count = 0;
+	u64 epoch = 0; // epoch at which the bag was sealed
+	Bag* next = nullptr;
+
+	void release() noexcept {
+		for (usize i = 0; i < count; ++i) {
+			items[i].deleter(items[i].ptr);
+		}
+		count = 0;
+	}
+};
+
+// participants are only unlinked when the manager dies, so scanning threads may walk the list without locking;
+// every participant occupies its own cache lines, since its state word is written on each pin
+struct alignas(kHardwareDestructiveInterferenceSize) EpochManager::Participant final {
+	std::atomic<u64> state{0};
+	std::atomic<bool> inUse{true};
+	Participant* next = nullptr;
+	EpochManager* manager = nullptr;
+
+	// owned by the registered thread
+	usize pins = 0;
+	Bag* bags = nullptr; // the open bag first, then sealed bags from newest to oldest
+
+	/// Frees all sealed bags which are at least two epochs old.
+	void collect(u64 epoch) noexcept {
+		Bag* prev = bags;
+		while (prev && prev->next && prev->next->epoch + 2 > epoch) {
+			prev = prev->next;
+		}
+		if (!prev) {
+			return;
+		}
+		for (Bag* bag = exchange(prev->next, nullptr); bag;) {
+			bag->release();
+			delete exchange(bag, bag->next);
+		}
+	}
+};
+
+RB_WARNING_POP
+
+EpochManager::Handle::Handle(Participant* participant) noexcept
+    : participant_(participant) {
+}
+
+EpochManager::Handle::Handle(Handle&& rhs) noexcept
+    : participant_(exchange(rhs.participant_, nullptr)) {
+}
+
+EpochManager::Handle::~Handle() {
+	if (!participant_) {
+		return;
+	}
+
+	RB_ASSERT_MSG("handle destroyed while pinned", participant_->pins == 0);
+	EpochManager* const manager = participant_->manager;
+	u64 const epoch = manager->epoch();
+	if (Bag* const bags = exchange(participant_->bags, nullptr)) {
+		// the bags outlive the thread, so the next collecting thread will release them
+		bags->epoch = epoch; // seal the open bag
+		Bag* last = bags;
+		while (last->next) {
+			last = last->next;
+		}
+		SpinLocker const locker(manager->orphans_->lock);
+		last->next = manager->orphans_->head;
+		manager->orphans_->head = bags;
+	}
+	participant_->inUse.store(false, std::memory_order_release);
+}
+
+EpochManager::Handle& EpochManager::Handle::operator=(Handle&& rhs) noexcept {
+	if (this != &rhs) {
+		this->~Handle();
+		new (this) Handle(RB_MOVE(rhs));
+	}
+	return *this;
+}
+
+EpochManager::Guard EpochManager::Handle::pin() noexcept {
+	if (participant_->pins++ == 0) {
+		u64 const epoch = participant_->manager->epoch_->load(std::memory_order_relaxed);
+		participant_->state.store(epoch << 1 | kPinned, std::memory_order_relaxed);
+		// the pin must be visible before any load of the protected structure
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+	}
+	return Guard(*this);
+}
+
+bool EpochManager::Handle::isPinned() const noexcept {
+	return participant_->pins > 0;
+}
+
+RB_WARNING_PUSH
+RB_WARNING_POSSIBLE_NULL_ARGUMENT
+
+void EpochManager::Handle::retire(void* ptr, void (*deleter)(void*)) {
+	RB_ASSERT(deleter);
+	Bag* bag = participant_->bags;
+	if (!bag || bag->count == kBatchSize) {
+		bag = new Bag;
+		bag->next = participant_->bags;
+		participant_->bags = bag;
+	}
+	bag->items[bag->count++] = {ptr, deleter};
+	if (bag->count == kBatchSize) {
+		flush();
+	}
+}
+
+void EpochManager::Handle::flush() {
+	EpochManager* const manager = participant_->manager;
+	Bag* const open = participant_->bags;
+	if (open && open->count > 0) {
+		// seal the open bag and start a new one
+		open->epoch = manager->epoch();
+		Bag* const empty = new Bag;
+		empty->next = open;
+		participant_->bags = empty;
+	}
+	manager->tryAdvance();
+	participant_->collect(manager->epoch());
+	manager->collectOrphans();
+}
+
+RB_WARNING_POP
+
+EpochManager::Guard::Guard(Handle& handle) noexcept
+    : handle_(handle) {
+}
+
+EpochManager::Guard::~Guard() {
+	if (--handle_.participant_->pins == 0) {
+		handle_.participant_->state.store(0, std::memory_order_release);
+	}
+}
+
+EpochManager::EpochManager() noexcept
+    : epoch_(0)
+    , participants_(nullptr) {
+}
+
+EpochManager::~EpochManager() {
+	// no handles are left, so nothing can be observed anymore
+	for (Participant* participant = participants_.load(std::memory_order_acquire); participant;) {
+		RB_ASSERT_MSG("handle outlives the manager", !participant->inUse.load(std::memory_order_relaxed));
+		delete exchange(participant, participant->next);
+	}
+	for (Bag* bag = orphans_->head; bag;) {
+		bag->release();
+		delete exchange(bag, bag->next);
+	}
+}
+
+EpochManager& EpochManager::global() noexcept {
+	static EpochManager manager;
+	return manager;
+}
+
+EpochManager::Handle& EpochManager::local() {
+	static thread_local Handle handle = global().registerThread();
+	return handle;
+}
+
+EpochManager::Handle EpochManager::registerThread() {
+	Participant* head = participants_.load(std::memory_order_acquire);
+	for (Participant* participant = head; participant; participant = participant->next) {
+		bool expected = false;
+		if (participant->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+			return Handle(participant);
+		}
+	}
+
+	auto* const participant = new Participant;
+	participant->manager = this;
+	participant->next = head;
+	while (!participants_.compare_exchange_weak(participant->next, participant, std::memory_order_release)) {
+	}
+	return Handle(participant);
+}
+
+u64 EpochManager::epoch() const noexcept {
+	return epoch_->load(std::memory_order_acquire);
+}
+
+bool EpochManager::tryAdvance() noexcept {
+	u64 current = epoch_->load(std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	for (Participant* participant = participants_.load(std::memory_order_acquire); participant;
+	     participant = participant->next) {
+		u64 const state = participant->state.load(std::memory_order_relaxed);
+		if ((state & kPinned) && (state >> 1) != current) {
+			return false;
+		}
+	}
+	std::atomic_thread_fence(std::memory_order_acquire);
+	// a failure means another thread has advanced the epoch already
+	epoch_->compare_exchange_strong(current, current + 1, std::memory_order_release, std::memory_order_relaxed);
+	return true;
+}
+
+void EpochManager::collectOrphans() noexcept {
+	if (orphans_->lock.test_and_set(std::memory_order_acquire)) {
+		return; // somebody else is collecting
+	}
+
+	Bag* ready = nullptr;
+	u64 const current = epoch();
+	for (Bag** link = &orphans_->head; *link;) {
+		Bag* const bag = *link;
+		if (bag->count == 0 || bag->epoch + 2 <= current) {
+			*link = bag->next;
+			bag->next = ready;
+			ready = bag;
+		} else {
+			link = &bag->next;
+		}
+	}
+	orphans_->lock.clear(std::memory_order_release);
+
+	while (ready) {
+		ready->release();
+		delete exchange(ready, ready->next);
+	}
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+
+#include <rb/core/export.hpp>
+#include <rb/core/helpers.hpp>
+#include <rb/core/memory/CachePadded.hpp>
+#include <rb/core/memory/DefaultDeleter.hpp>
+#include <rb/core/traits/builtins.hpp>
+#include <rb/core/traits/constructible.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	RB_WARNING_PUSH
+	RB_WARNING_PADDING
+
+	/**
+	 * EpochManager implements epoch-based reclamation (EBR) for lock-free data structures.
+	 *
+	 * Readers pin the current epoch for the duration of an operation; writers retire unlinked nodes instead of
+	 * deleting them. Retired nodes are gathered into per-thread batches of #kBatchSize, and a batch is released
+	 * once the global epoch has advanced twice since it was sealed, i.e. once no thread can still hold a reference.
+	 * The epoch advances only when every pinned thread has observed the current one,
+	 * so a thread stuck inside a pinned section delays reclamation indefinitely;
+	 * use HazardPointer when the amount of unreclaimed memory must be bounded.
+	 *
+	 * Each thread participates through its own Handle obtained from registerThread() (or local() for global()).
+	 * All handles must be destroyed before the manager.
+	 */
+	class RB_EXPORT EpochManager final {
+		struct Participant;
+
+	public:
+		/// Number of retired nodes collected before a thread tries to advance the epoch and reclaim.
+		static constexpr usize kBatchSize = 64;
+
+		class Guard;
+
+		/// Registration of a thread in the manager; must only be used by the thread which owns it.
+		class RB_EXPORT Handle final {
+		public:
+			Handle(Handle&& rhs) noexcept;
+			~Handle();
+
+			Handle& operator=(Handle&& rhs) noexcept;
+
+			/// Pins the current epoch until the returned guard is destroyed; guards may nest.
+			[[nodiscard]] Guard pin() noexcept;
+
+			bool isPinned() const noexcept;
+
+			/// Schedules @p deleter to be called with @p ptr once no pinned thread can observe it.
+			/// @p ptr must be already unreachable for threads which pin after this call.
+			void retire(void* ptr, void (*deleter)(void*));
+
+			/// Schedules deletion of @p ptr with a default-constructed stateless deleter @p D.
+			template <class D = DefaultDeleter, class T>
+			void retire(T* ptr) {
+				static_assert(isEmpty<D> && isDefaultConstructible<D>, "deleter must be stateless");
+				retire(const_cast<void*>(static_cast<void const*>(ptr)), [](void* p) {
+					D{}(static_cast<T*>(p));
+				});
+			}
+
+			/// Seals the pending batch, tries to advance the epoch and reclaims everything that is safe to free.
+			void flush();
+
+		private:
+			friend class EpochManager;
+
+			explicit Handle(Participant* participant) noexcept;
+
+			Participant* participant_;
+		};
+
+		/// RAII pin of an epoch, see Handle::pin().
+		class RB_EXPORT Guard final {
+		public:
+			~Guard();
+
+			RB_DISABLE_COPY_MOVE(Guard)
+
+			template <class D = DefaultDeleter, class T>
+			void retire(T* ptr) const {
+				handle_.retire<D>(ptr);
+			}
+
+			void retire(void* ptr, void (*deleter)(void*)) const {
+				handle_.retire(ptr, deleter);
+			}
+
+		private:
+			friend class Handle;
+
+			explicit Guard(Handle& handle) noexcept;
+
+			Handle& handle_;
+		};
+
+		EpochManager() noexcept;
+		~EpochManager();
+
+		RB_DISABLE_COPY_MOVE(EpochManager)
+
+		static EpochManager& global() noexcept;
+
+		/// @return the calling thread's handle registered in global()
+		static Handle& local();
+
+		/// Registers the calling thread; slots of destroyed handles are reused.
+		[[nodiscard]] Handle registerThread();
+
+		u64 epoch() const noexcept;
+
+		/// Advances the global epoch if every pinned thread has observed the current one.
+		/// @return whether the epoch was advanced (by this or another thread)
+		bool tryAdvance() noexcept;
+
+	private:
+		struct Bag;
+
+		// the lock shares the cache line with the bags it protects
+		struct Orphans {
+			// user-provided, since the implicit one isn't usable until the enclosing class is complete
+			Orphans() noexcept {} // NOLINT(*-use-equals-default)
+
+			std::atomic_flag lock = ATOMIC_FLAG_INIT;
+			Bag* head = nullptr;
+		};
+
+		void collectOrphans() noexcept;
+
+		CachePadded<std::atomic<u64>> epoch_;
+		// read by every tryAdvance(), but written only when a thread is registered
+		std::atomic<Participant*> participants_;
+		// written by exiting and collecting threads
+		CachePadded<Orphans> orphans_;
+	};
+
+	RB_WARNING_POP
+
+} // namespace memory
+} // namespace rb::core
@@ -0,0 +1,178 @@
+#include "HazardPointer.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include <rb/core/assert.hpp>
+#include <rb/core/exchange.hpp>
+#include <rb/core/memory/CachePadded.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+class SpinLocker final {
+public:
+	explicit SpinLocker(std::atomic_flag& flag) noexcept
+	    : flag_(flag) {
+		while (flag_.test_and_set(std::memory_order_acquire)) {
+		}
+	}
+
+	~SpinLocker() {
+		flag_.clear(std::memory_order_release);
+	}
+
+	RB_DISABLE_COPY_MOVE(SpinLocker)
+
+private:
+	std::atomic_flag& flag_;
+};
+
+} // namespace
+
+RB_WARNING_PUSH
+RB_WARNING_PADDING
+
+// slots are only unlinked when the domain dies, so scanning threads may walk the list without locking;
+// every slot occupies its own cache lines, since it is written on each protected load
+struct alignas(kHardwareDestructiveInterferenceSize) HazardDomain::Slot final {
+	std::atomic<void const*> ptr{nullptr};
+	std::atomic<bool> inUse{true};
+	Slot* next = nullptr;
+};
+
+struct HazardDomain::Retired final {
+	void* ptr;
+	void (*deleter)(void*);
+	Retired* next;
+};
+
+RB_WARNING_POP
+
+HazardDomain::HazardDomain() noexcept
+    : slots_(nullptr)
+    , slotCount_(0)
+    , retiredCount_(0) {
+}
+
+HazardDomain::~HazardDomain() {
+	for (Slot* slot = slots_.load(std::memory_order_acquire); slot;) {
+		RB_ASSERT_MSG("hazard pointer outlives the domain", !slot->inUse.load(std::memory_order_relaxed));
+		delete exchange(slot, slot->next);
+	}
+	for (Retired* node = retired_->head; node;) {
+		node->deleter(node->ptr);
+		delete exchange(node, node->next);
+	}
+}
+
+HazardDomain& HazardDomain::global() noexcept {
+	static HazardDomain domain;
+	return domain;
+}
+
+void HazardDomain::retire(void* ptr, void (*deleter)(void*)) {
+	RB_ASSERT(deleter);
+	auto* const node = new Retired{ptr, deleter, nullptr};
+	{
+		SpinLocker const locker(retired_->lock);
+		node->next = retired_->head;
+		retired_->head = node;
+	}
+	usize const count = retiredCount_->fetch_add(1, std::memory_order_relaxed) + 1;
+	if (count >= kRetireThreshold + 2 * slotCount_.load(std::memory_order_relaxed)) {
+		reclaim();
+	}
+}
+
+void HazardDomain::reclaim() {
+	Retired* list = nullptr;
+	{
+		SpinLocker const locker(retired_->lock);
+		list = exchange(retired_->head, nullptr);
+	}
+	if (!list) {
+		return;
+	}
+
+	// pairs with the fence in HazardPointer::set(): either the reader sees the node unlinked, or we see its hazard
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	// slots linked after the head is loaded can't protect nodes which are already unlinked,
+	// and slots are counted before they are linked, so the list from the head fits into `capacity`
+	Slot* const head = slots_.load(std::memory_order_acquire);
+	usize const capacity = slotCount_.load(std::memory_order_acquire);
+	auto* const hazards = new void const*[capacity == 0 ? 1 : capacity];
+	usize count = 0;
+	for (Slot* slot = head; slot && count < capacity; slot = slot->next) {
+		if (void const* const ptr = slot->ptr.load(std::memory_order_acquire)) {
+			hazards[count++] = ptr;
+		}
+	}
+	std::sort(hazards, hazards + count, std::less<>());
+
+	Retired* kept = nullptr;
+	Retired* keptLast = nullptr;
+	usize reclaimed = 0;
+	while (list) {
+		Retired* const node = exchange(list, list->next);
+		if (std::binary_search(hazards, hazards + count, static_cast<void const*>(node->ptr), std::less<>())) {
+			node->next = kept;
+			kept = node;
+			if (!keptLast) {
+				keptLast = node;
+			}
+		} else {
+			node->deleter(node->ptr);
+			delete node;
+			++reclaimed;
+		}
+	}
+	delete[] hazards;
+
+	retiredCount_->fetch_sub(reclaimed, std::memory_order_relaxed);
+	if (kept) {
+		SpinLocker const locker(retired_->lock);
+		keptLast->next = retired_->head;
+		retired_->head = kept;
+	}
+}
+
+usize HazardDomain::retiredCount() const noexcept {
+	return retiredCount_->load(std::memory_order_relaxed);
+}
+
+HazardDomain::Slot* HazardDomain::acquireSlot() {
+	Slot* head = slots_.load(std::memory_order_acquire);
+	for (Slot* slot = head; slot; slot = slot->next) {
+		bool expected = false;
+		if (slot->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+			return slot;
+		}
+	}
+
+	auto* const slot = new Slot;
+	slotCount_.fetch_add(1, std::memory_order_release);
+	slot->next = head;
+	while (!slots_.compare_exchange_weak(slot->next, slot, std::memory_order_release)) {
+	}
+	return slot;
+}
+
+HazardPointer::HazardPointer(HazardDomain& domain)
+    : slot_(domain.acquireSlot()) {
+}
+
+HazardPointer::~HazardPointer() {
+	slot_->ptr.store(nullptr, std::memory_order_release);
+	slot_->inUse.store(false, std::memory_order_release);
+}
+
+void HazardPointer::set(void const* ptr) noexcept {
+	slot_->ptr.store(ptr, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void HazardPointer::reset() noexcept {
+	slot_->ptr.store(nullptr, std::memory_order_release);
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+
+#include <rb/core/export.hpp>
+#include <rb/core/helpers.hpp>
+#include <rb/core/memory/CachePadded.hpp>
+#include <rb/core/memory/DefaultDeleter.hpp>
+#include <rb/core/traits/builtins.hpp>
+#include <rb/core/traits/constructible.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	RB_WARNING_PUSH
+	RB_WARNING_PADDING
+
+	/**
+	 * HazardDomain is a set of hazard pointers and the nodes retired against them.
+	 *
+	 * Unlike EpochManager, a stalled reader delays reclamation only of the nodes it actually protects,
+	 * so the number of unreclaimed nodes stays bounded by `#kRetireThreshold + 2 * (number of hazard pointers)`,
+	 * at the cost of a store and a full fence per protected load.
+	 *
+	 * All hazard pointers must be destroyed before the domain; nodes still retired then are deleted by the domain.
+	 */
+	class RB_EXPORT HazardDomain final {
+	public:
+		/// Number of retired nodes above twice the number of hazard pointers which triggers a reclamation scan.
+		static constexpr usize kRetireThreshold = 64;
+
+		HazardDomain() noexcept;
+		~HazardDomain();
+
+		RB_DISABLE_COPY_MOVE(HazardDomain)
+
+		static HazardDomain& global() noexcept;
+
+		/// Schedules @p deleter to be called with @p ptr once no hazard pointer of the domain protects it.
+		/// @p ptr must be already unreachable for new readers.
+		void retire(void* ptr, void (*deleter)(void*));
+
+		/// Schedules deletion of @p ptr with a default-constructed stateless deleter @p D.
+		template <class D = DefaultDeleter, class T>
+		void retire(T* ptr) {
+			static_assert(isEmpty<D> && isDefaultConstructible<D>, "deleter must be stateless");
+			retire(const_cast<void*>(static_cast<void const*>(ptr)), [](void* p) {
+				D{}(static_cast<T*>(p));
+			});
+		}
+
+		/// Deletes every retired node which is not protected at the moment.
+		void reclaim();
+
+		/// @return number of nodes retired but not yet deleted
+		usize retiredCount() const noexcept;
+
+	private:
+		friend class HazardPointer;
+
+		struct Slot;
+		struct Retired;
+
+		// the lock shares the cache line with the list it protects
+		struct RetiredList {
+			// user-provided, since the implicit one isn't usable until the enclosing class is complete
+			RetiredList() noexcept {} // NOLINT(*-use-equals-default)
+
+			std::atomic_flag lock = ATOMIC_FLAG_INIT;
+			Retired* head = nullptr;
+		};
+
+		Slot* acquireSlot();
+
+		// read by every scan, but written only when a slot is added
+		std::atomic<Slot*> slots_;
+		std::atomic<usize> slotCount_;
+		// written by every retiring thread
+		CachePadded<RetiredList> retired_;
+		CachePadded<std::atomic<usize>> retiredCount_;
+	};
+
+	/**
+	 * HazardPointer owns a single slot of a HazardDomain and announces the pointer the owning thread is about to
+	 * dereference, so the node isn't deleted under it.
+	 */
+	class RB_EXPORT HazardPointer final {
+	public:
+		explicit HazardPointer(HazardDomain& domain = HazardDomain::global());
+		~HazardPointer();
+
+		RB_DISABLE_COPY_MOVE(HazardPointer)
+
+		/// Loads @p src and protects the loaded pointer; it stays valid until reset() or the next protect().
+		template <class T>
+		T* protect(std::atomic<T*> const& src) noexcept {
+			T* ptr = src.load(std::memory_order_relaxed);
+			for (;;) {
+				set(ptr);
+				// the node might have been retired between the load and the announcement; confirm it's still linked
+				T* const current = src.load(std::memory_order_acquire);
+				if (current == ptr) {
+					return ptr;
+				}
+				ptr = current;
+			}
+		}
+
+		/// Announces @p ptr unconditionally; the caller must validate it is still reachable afterward.
+		void set(void const* ptr) noexcept;
+
+		void reset() noexcept;
+
+	private:
+		HazardDomain::Slot* slot_;
+	};
+
+	RB_WARNING_POP
+
+} // namespace memory
+} // namespace rb::core
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#include <rb/core/attributes.hpp>
+#include <rb/core/helpers.hpp>
+#include <rb/core/memory/AllocationResult.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	template <class T, usize capacity>
+	class InlineArenaAllocator;
+
+	RB_WARNING_PUSH
+	RB_WARNING_PADDING
+
+	/**
+	 * InlineArena serves allocations from a byte array stored inside the object itself,
+	 * so an arena declared as a local variable provides stack-resident scratch memory;
+	 * requests which don't fit fall back to the heap.
+	 *
+	 * The arena is a bump allocator: only the most recent inline allocation is given back on deallocation,
+	 * other inline blocks are reclaimed when the arena is destroyed or reset().
+	 * Containers are plugged in via allocator<T>() (see InlineArenaAllocator) and must not outlive the arena.
+	 *
+	 * @tparam capacity The size of the inline buffer in bytes.
+	 */
+	template <usize capacity>
+	class InlineArena final {
+		static_assert(capacity > 0, "arena must have a non-empty buffer");
+
+	public:
+		InlineArena() noexcept = default;
+
+		RB_DISABLE_COPY_MOVE(InlineArena)
+
+		/// Allocates @p bytes aligned to @p align, from the inline buffer if there is enough room left.
+		/// @throw std::bad_alloc if the heap fallback fails
+		[[nodiscard]] RB_ALLOCATOR RB_RETURNS_NONNULL void* allocate(usize bytes, usize align) {
+			usize const base = reinterpret_cast<usize>(buffer_);
+			usize const start = (base + offset_ + align - 1) & ~(align - 1);
+			// the end of a full buffer isn't handed out for empty blocks, since owns() doesn't recognise it
+			if (start - base < capacity && bytes <= capacity - (start - base)) {
+				offset_ = start - base + bytes;
+				return buffer_ + (start - base);
+			}
+			if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+				return operator new(bytes, std::align_val_t{align});
+			}
+			return operator new(bytes);
+		}
+
+		/// Releases a block obtained from allocate() with the same @p bytes and @p align.
+		void deallocate(void* ptr, usize bytes, usize align) noexcept {
+			if (!owns(ptr)) {
+				if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+					::operator delete(ptr,
+#ifdef __cpp_sized_deallocation
+					    bytes,
+#endif
+					    std::align_val_t{align});
+				} else {
+					::operator delete(ptr
+#ifdef __cpp_sized_deallocation
+					    ,
+					    bytes
+#endif
+					);
+				}
+			} else if (static_cast<unsigned char*>(ptr) + bytes == buffer_ + offset_) {
+				offset_ -= bytes;
+			}
+		}
+
+		/// @return whether @p ptr points into the inline buffer
+		bool owns(void const* ptr) const noexcept {
+			// compare integers, since relational comparison of unrelated pointers is unspecified
+			auto const address = reinterpret_cast<usize>(ptr);
+			auto const base = reinterpret_cast<usize>(buffer_);
+			return address >= base && address < base + capacity;
+		}
+
+		/// @return number of bytes of the inline buffer in use, including alignment gaps
+		constexpr usize used() const noexcept {
+			return offset_;
+		}
+
+		/// Makes the whole inline buffer available again; all inline blocks must be already released.
+		constexpr void reset() noexcept {
+			offset_ = 0;
+		}
+
+		template <class T>
+		constexpr InlineArenaAllocator<T, capacity> allocator() noexcept {
+			return InlineArenaAllocator<T, capacity>(*this);
+		}
+
+	private:
+		alignas(std::max_align_t) unsigned char buffer_[capacity];
+		usize offset_ = 0;
+	};
+
+	RB_WARNING_POP
+
+	/// Allocator adapter which obtains memory from an InlineArena; copies share the arena.
+	template <class T, usize capacity>
+	class InlineArenaAllocator {
+	public:
+		using Value = T;
+		using Size = usize;
+		using Difference = isize;
+
+		template <class U>
+		using Rebind = InlineArenaAllocator<U, capacity>;
+
+		constexpr explicit InlineArenaAllocator(InlineArena<capacity>& arena) noexcept
+		    : arena_(&arena) {
+		}
+
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		template <class U>
+		constexpr InlineArenaAllocator(InlineArenaAllocator<U, capacity> const& rhs) noexcept // NOLINT(google-explicit-constructor)
+		    : arena_(&rhs.arena()) {
+		}
+
+		[[nodiscard]] RB_ALLOCATOR RB_RETURNS_NONNULL T* allocate(Size n) {
+			RB_CHECK_COMPLETENESS(T);
+			if (n > static_cast<Size>(-1) / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+			return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		[[nodiscard]] AllocationResult<T*> allocateAtLeast(Size n) {
+			return {allocate(n), n};
+		}
+
+		void deallocate(T* ptr, Size n) noexcept {
+			arena_->deallocate(ptr, n * sizeof(T), alignof(T));
+		}
+
+		constexpr InlineArena<capacity>& arena() const noexcept {
+			return *arena_;
+		}
+
+	private:
+		InlineArena<capacity>* arena_;
+	};
+
+	template <class T, class U, usize capacity>
+	constexpr bool operator==(
+	    InlineArenaAllocator<T, capacity> const& lhs,
+	    InlineArenaAllocator<U, capacity> const& rhs) noexcept {
+		return &lhs.arena() == &rhs.arena();
+	}
+
+	template <class T, class U, usize capacity>
+	constexpr bool operator!=(
+	    InlineArenaAllocator<T, capacity> const& lhs,
+	    InlineArenaAllocator<U, capacity> const& rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+} // namespace memory
+} // namespace rb::core
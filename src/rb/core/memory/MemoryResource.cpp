@@ -0,0 +1,82 @@
+#include "MemoryResource.hpp"
+
+#include <atomic>
+#include <new>
+
+#include <rb/core/helpers.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+class NewDeleteResource final : public MemoryResource {
+	void* doAllocate(usize bytes, usize align) override {
+#ifdef __cpp_aligned_new
+		if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			return ::operator new(bytes, std::align_val_t{align});
+		}
+#endif
+		RB_UNUSED(align);
+		return ::operator new(bytes);
+	}
+
+	void doDeallocate(void* ptr, [[maybe_unused]] usize bytes, usize align) override {
+#ifdef __cpp_aligned_new
+		if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+	#ifdef __cpp_sized_deallocation
+			::operator delete(ptr, bytes, std::align_val_t{align});
+	#else
+			::operator delete(ptr, std::align_val_t{align});
+	#endif
+			return;
+		}
+#endif
+		RB_UNUSED(align);
+#ifdef __cpp_sized_deallocation
+		::operator delete(ptr, bytes);
+#else
+		::operator delete(ptr);
+#endif
+	}
+
+	bool doIsEqual(MemoryResource const& rhs) const noexcept override {
+		return this == &rhs;
+	}
+};
+
+class NullResource final : public MemoryResource {
+	void* doAllocate(usize /*bytes*/, usize /*align*/) override {
+		throw std::bad_alloc();
+	}
+
+	void doDeallocate(void* /*ptr*/, usize /*bytes*/, usize /*align*/) override {
+	}
+
+	bool doIsEqual(MemoryResource const& rhs) const noexcept override {
+		return this == &rhs;
+	}
+};
+
+// constant-initialized, so they are usable during dynamic initialization of other TUs
+NewDeleteResource newDelete;
+NullResource null;
+
+std::atomic<MemoryResource*> defaultRes{&newDelete};
+
+} // namespace
+
+MemoryResource* memory::newDeleteResource() noexcept {
+	return &newDelete;
+}
+
+MemoryResource* memory::nullResource() noexcept {
+	return &null;
+}
+
+MemoryResource* memory::defaultResource() noexcept {
+	return defaultRes.load(std::memory_order_acquire);
+}
+
+MemoryResource* memory::setDefaultResource(MemoryResource* resource) noexcept {
+	return defaultRes.exchange(resource ? resource : &newDelete, std::memory_order_acq_rel);
+}
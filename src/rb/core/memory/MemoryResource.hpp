@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+
+#include <rb/core/attributes.hpp>
+#include <rb/core/export.hpp>
+#include <rb/core/types.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	/**
+	 * MemoryResource is an abstract interface to an unbounded set of classes encapsulating memory resources.
+	 * It allows a single container type (see PolymorphicAllocator) to be backed by heap, arena, pool, etc.,
+	 * selected at runtime.
+	 */
+	class RB_EXPORT MemoryResource {
+	public:
+		/// Default alignment of allocate() and deallocate().
+		static constexpr usize kMaxAlign = alignof(std::max_align_t);
+
+		MemoryResource() = default;
+		MemoryResource(MemoryResource const&) = default;
+		virtual ~MemoryResource() = default;
+
+		MemoryResource& operator=(MemoryResource const&) = default;
+
+		/// Allocates storage with a size of at least @p bytes bytes, aligned to the specified @p align.
+		/// @throw std::bad_alloc (or other exception) if storage can't be obtained.
+		[[nodiscard]] RB_ALLOCATOR RB_RETURNS_NONNULL void* allocate(usize bytes, usize align = kMaxAlign) {
+			return doAllocate(bytes, align);
+		}
+
+		/// Deallocates the storage pointed to by @p ptr,
+		/// which must have been returned by a prior call to `allocate(bytes, align)` on an equal resource.
+		void deallocate(void* ptr, usize bytes, usize align = kMaxAlign) {
+			doDeallocate(ptr, bytes, align);
+		}
+
+		/// @return whether memory allocated from @c this can be deallocated from @p rhs and vice versa.
+		bool isEqual(MemoryResource const& rhs) const noexcept {
+			return this == &rhs || doIsEqual(rhs);
+		}
+
+	private:
+		virtual void* doAllocate(usize bytes, usize align) = 0;
+		virtual void doDeallocate(void* ptr, usize bytes, usize align) = 0;
+		virtual bool doIsEqual(MemoryResource const& rhs) const noexcept = 0;
+	};
+
+	inline bool operator==(MemoryResource const& lhs, MemoryResource const& rhs) noexcept {
+		return lhs.isEqual(rhs);
+	}
+
+	inline bool operator!=(MemoryResource const& lhs, MemoryResource const& rhs) noexcept {
+		return !lhs.isEqual(rhs);
+	}
+
+	/// @return a resource that uses the global `operator new` and `operator delete`.
+	RB_EXPORT RB_RETURNS_NONNULL MemoryResource* newDeleteResource() noexcept;
+
+	/// @return a resource that throws `std::bad_alloc` on every allocation attempt.
+	RB_EXPORT RB_RETURNS_NONNULL MemoryResource* nullResource() noexcept;
+
+	/// @return the resource used by default-constructed PolymorphicAllocator (initially newDeleteResource()).
+	RB_EXPORT RB_RETURNS_NONNULL MemoryResource* defaultResource() noexcept;
+
+	/// Sets the default resource to @p resource, or to newDeleteResource() if @p resource is `nullptr`.
+	/// @return the previous default resource.
+	RB_EXPORT RB_RETURNS_NONNULL MemoryResource* setDefaultResource(MemoryResource* resource) noexcept;
+
+} // namespace memory
+} // namespace rb::core
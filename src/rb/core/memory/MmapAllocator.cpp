@@ -0,0 +1,185 @@
+#include "MmapAllocator.hpp"
+
+#include <rb/core/helpers.hpp>
+#include <rb/core/os.hpp>
+
+#ifdef RB_OS_WIN
+	#include <rb/core/windows.hpp>
+#else
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
+using namespace rb::core;
+
+namespace {
+
+constexpr usize kHugePageSize = usize{2} << 20;
+
+usize pageSize() noexcept {
+#ifdef RB_OS_WIN
+	static usize const size = [] {
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return static_cast<usize>(info.dwPageSize);
+	}();
+#else
+	static usize const size = static_cast<usize>(sysconf(_SC_PAGESIZE));
+#endif
+	return size;
+}
+
+/// Both allocation and deallocation must round the same way, so the length passed to `munmap` matches.
+usize roundUp(usize bytes, MmapOptions options) noexcept {
+	usize const granularity = options.testFlag(MmapOption::kHugeTlb) ? kHugePageSize : pageSize();
+	if (bytes == 0) {
+		return granularity;
+	}
+	return (bytes + granularity - 1) / granularity * granularity;
+}
+
+void touch(void* ptr, usize size) noexcept {
+	auto* const bytePtr = static_cast<unsigned char volatile*>(ptr);
+	for (usize offset = 0; offset < size; offset += pageSize()) {
+		bytePtr[offset] = 0;
+	}
+}
+
+#ifndef RB_OS_WIN
+
+int mapFlags(bool populate) noexcept {
+	int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+	#ifdef MAP_POPULATE
+	if (populate) {
+		flags |= MAP_POPULATE;
+	}
+	#else
+	RB_UNUSED(populate);
+	#endif
+	return flags;
+}
+
+void* map(usize size, int flags) {
+	void* const ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+	if (ptr == MAP_FAILED) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+/// Transparent huge pages can only back 2 MiB aligned ranges,
+/// so a range larger by the alignment is mapped and trimmed to the boundary.
+void* mapHugeAligned(usize size) {
+	if (size < kHugePageSize) {
+		return map(size, mapFlags(false));
+	}
+
+	usize const padded = size + kHugePageSize - pageSize();
+	if (padded < size) {
+		throw std::bad_alloc();
+	}
+	auto* const ptr = static_cast<unsigned char*>(map(padded, mapFlags(false)));
+	usize const head = (kHugePageSize - reinterpret_cast<usize>(ptr) % kHugePageSize) % kHugePageSize;
+	usize const tail = padded - head - size;
+	if (head) {
+		munmap(ptr, head);
+	}
+	if (tail) {
+		munmap(ptr + head + size, tail);
+	}
+	return ptr + head;
+}
+
+/// `MAP_POPULATE` would fault the range in as regular pages before `MADV_HUGEPAGE` is applied,
+/// so huge page mappings are populated after the advice.
+void prefault(void* ptr, usize size) noexcept {
+	#ifdef MADV_POPULATE_WRITE
+	if (madvise(ptr, size, MADV_POPULATE_WRITE) == 0) {
+		return;
+	}
+	#endif
+	// the kernel is older than 5.14
+	touch(ptr, size);
+}
+
+#endif
+
+} // namespace
+
+void* impl::mmapAllocate(usize bytes, MmapOptions options) {
+	usize const size = roundUp(bytes, options);
+	if (size < bytes) {
+		throw std::bad_alloc();
+	}
+
+	bool const populate = options.testFlag(MmapOption::kPopulate);
+#ifdef RB_OS_WIN
+	// large pages require SeLockMemoryPrivilege, so Windows always gets regular pages
+	void* const ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	if (populate) {
+		touch(ptr, size);
+	}
+	return ptr;
+#else
+	#ifdef MAP_HUGETLB
+	if (options.testFlag(MmapOption::kHugeTlb)) {
+		void* const ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, mapFlags(populate) | MAP_HUGETLB, -1, 0);
+		if (ptr != MAP_FAILED) {
+			return ptr;
+		}
+	}
+	#endif
+
+	if (!options.testFlag(MmapOption::kHugePages) && !options.testFlag(MmapOption::kHugeTlb)) {
+		void* const ptr = map(size, mapFlags(populate));
+	#ifndef MAP_POPULATE
+		if (populate) {
+			touch(ptr, size);
+		}
+	#endif
+		return ptr;
+	}
+
+	void* const ptr = mapHugeAligned(size);
+	#ifdef MADV_HUGEPAGE
+	madvise(ptr, size, MADV_HUGEPAGE); // only a hint
+	#endif
+	if (populate) {
+		prefault(ptr, size);
+	}
+	return ptr;
+#endif
+}
+
+void impl::mmapDeallocate(void* ptr, usize bytes, MmapOptions options) noexcept {
+	if (!ptr) {
+		return;
+	}
+
+#ifdef RB_OS_WIN
+	RB_UNUSED(bytes);
+	RB_UNUSED(options);
+	VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+	munmap(ptr, roundUp(bytes, options));
+#endif
+}
+
+void impl::mmapRelease(void* ptr, usize bytes, MmapOptions options) noexcept {
+	if (!ptr) {
+		return;
+	}
+
+	usize const size = roundUp(bytes, options);
+#ifdef RB_OS_WIN
+	// MEM_RESET keeps the range committed but lets the OS discard its contents;
+	// unlike MADV_DONTNEED it doesn't guarantee zeroes, so decommit/commit instead
+	VirtualFree(ptr, size, MEM_DECOMMIT);
+	VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE);
+#else
+	madvise(ptr, size, MADV_DONTNEED);
+#endif
+}
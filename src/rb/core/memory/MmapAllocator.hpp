@@ -0,0 +1,114 @@
+#pragma once
+
+#include <new>
+
+#include <rb/core/attributes.hpp>
+#include <rb/core/export.hpp>
+#include <rb/core/Flags.hpp>
+#include <rb/core/memory/AllocationResult.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	enum class MmapOption : u32 {
+		kNone = 0x00,
+		/// Ask for transparent huge pages (`MADV_HUGEPAGE`); mappings of 2 MiB and more are aligned to 2 MiB.
+		kHugePages = 0x01,
+		/// Map from the explicit huge page pool (`MAP_HUGETLB`); falls back to regular pages if the pool is empty.
+		/// Sizes are rounded up to the huge page size.
+		kHugeTlb = 0x02,
+		/// Pre-fault the whole mapping (`MAP_POPULATE`), so the first touch doesn't page fault;
+		/// with huge pages the mapping is populated after the advice (`MADV_POPULATE_WRITE`), so it gets huge pages.
+		kPopulate = 0x04,
+	};
+
+	using MmapOptions = Flags<MmapOption>;
+
+} // namespace memory
+
+namespace impl {
+
+	RB_EXPORT void* mmapAllocate(usize bytes, MmapOptions options);
+	RB_EXPORT void mmapDeallocate(void* ptr, usize bytes, MmapOptions options) noexcept;
+	RB_EXPORT void mmapRelease(void* ptr, usize bytes, MmapOptions options) noexcept;
+
+} // namespace impl
+
+inline namespace memory {
+
+	/**
+	 * MmapAllocator maps every allocation directly from the OS (`mmap` or `VirtualAlloc`).
+	 * Intended for large, long-living blocks such as lookup tables: the memory is page-aligned and zero-filled,
+	 * may be backed by huge pages to reduce TLB misses and may be pre-faulted to avoid first-touch latency spikes.
+	 */
+	template <class T>
+	class MmapAllocator {
+		static_assert(alignof(T) <= 4096, "mappings are only page-aligned");
+
+	public:
+		using Value = T;
+		using Size = usize;
+		using Difference = isize;
+
+		constexpr MmapAllocator() noexcept = default;
+
+		constexpr explicit MmapAllocator(MmapOptions options) noexcept
+		    : options_(options) {
+		}
+
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		template <class U>
+		constexpr MmapAllocator(MmapAllocator<U> const& rhs) noexcept // NOLINT(google-explicit-constructor)
+		    : options_(rhs.options()) {
+		}
+
+		/// Maps `n * sizeof(T)` bytes of zero-filled memory.
+		/// @throw std::bad_alloc if the mapping fails
+		[[nodiscard]] RB_ALLOCATOR RB_RETURNS_NONNULL T* allocate(Size n) {
+			RB_CHECK_COMPLETENESS(T);
+			if (n > static_cast<Size>(-1) / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+			return static_cast<T*>(impl::mmapAllocate(n * sizeof(T), options_));
+		}
+
+		[[nodiscard]] AllocationResult<T*> allocateAtLeast(Size n) {
+			return {allocate(n), n};
+		}
+
+		/// Fresh mappings are already zero-filled, see AllocatorTraits::allocateZeroed().
+		[[nodiscard]] T* allocateZeroed(Size n) {
+			return allocate(n);
+		}
+
+		void deallocate(T* ptr, Size n) noexcept {
+			impl::mmapDeallocate(ptr, n * sizeof(T), options_);
+		}
+
+		/// Returns the physical pages of the block to the OS (`madvise(MADV_DONTNEED)`) while keeping it mapped;
+		/// the memory reads as zeroes afterward on Linux and Windows.
+		void release(T* ptr, Size n) noexcept {
+			impl::mmapRelease(ptr, n * sizeof(T), options_);
+		}
+
+		constexpr MmapOptions options() const noexcept {
+			return options_;
+		}
+
+	private:
+		MmapOptions options_;
+	};
+
+	/// Allocators are equal if they round sizes the same way, i.e. have the same options.
+	template <class T, class U>
+	constexpr bool operator==(MmapAllocator<T> const& lhs, MmapAllocator<U> const& rhs) noexcept {
+		return lhs.options() == rhs.options();
+	}
+
+	template <class T, class U>
+	constexpr bool operator!=(MmapAllocator<T> const& lhs, MmapAllocator<U> const& rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+} // namespace memory
+} // namespace rb::core
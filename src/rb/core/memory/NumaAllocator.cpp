@@ -0,0 +1,212 @@
+#include "NumaAllocator.hpp"
+
+#include <rb/core/helpers.hpp>
+#include <rb/core/os.hpp>
+
+#ifdef RB_OS_WIN
+	#include <rb/core/windows.hpp>
+#elif defined(RB_OS_LINUX)
+	#include <cstdio>
+
+	#include <sched.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+
+	#if __has_include(<linux/mempolicy.h>)
+		#include <linux/mempolicy.h>
+	#else
+		#define MPOL_PREFERRED 1
+		#define MPOL_BIND 2
+		#define MPOL_MF_MOVE (1 << 1)
+	#endif
+#endif
+
+using namespace rb::core;
+
+namespace {
+
+#ifdef RB_OS_LINUX
+
+// nodes above the limit are treated as unknown, i.e. memory bound to them is left unbound
+constexpr usize kMaxNodes = 1024;
+constexpr usize kBitsPerWord = sizeof(unsigned long) * 8;
+
+struct NodeMask {
+	unsigned long words[kMaxNodes / kBitsPerWord] = {};
+
+	explicit NodeMask(usize node) noexcept {
+		words[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+	}
+
+	// the kernel ignores the last bit of `maxnode`
+	static constexpr unsigned long kMaxNode = kMaxNodes + 1;
+};
+
+/// Calls @p fn for every `first-last` range of a sysfs list such as `0-3,8-11`.
+/// @return `false` if the file can't be read
+template <class F>
+bool forEachRange(char const* path, F&& fn) noexcept {
+	std::FILE* const file = std::fopen(path, "r");
+	if (!file) {
+		return false;
+	}
+
+	unsigned long first = 0;
+	while (std::fscanf(file, "%lu", &first) == 1) {
+		unsigned long last = first;
+		int sep = std::fgetc(file);
+		if (sep == '-') {
+			if (std::fscanf(file, "%lu", &last) != 1) {
+				break;
+			}
+			sep = std::fgetc(file);
+		}
+		fn(static_cast<usize>(first), static_cast<usize>(last));
+		if (sep != ',') {
+			break;
+		}
+	}
+	std::fclose(file);
+	return true;
+}
+
+template <class F>
+bool forEachCpuOfNode(usize node, F&& fn) noexcept {
+	char path[64];
+	std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%zu/cpulist", node);
+	return forEachRange(path, RB_FWD(fn));
+}
+
+#endif
+
+} // namespace
+
+usize memory::numaNodeCount() noexcept {
+#ifdef RB_OS_WIN
+	static usize const count = [] {
+		ULONG highest = 0;
+		return GetNumaHighestNodeNumber(&highest) ? static_cast<usize>(highest) + 1 : 1;
+	}();
+#elif defined(RB_OS_LINUX)
+	static usize const count = [] {
+		usize highest = 0;
+		forEachRange("/sys/devices/system/node/online", [&](usize, usize last) {
+			highest = last > highest ? last : highest;
+		});
+		return highest < kMaxNodes ? highest + 1 : kMaxNodes;
+	}();
+#else
+	constexpr usize count = 1;
+#endif
+	return count;
+}
+
+usize memory::numaNodeOfCpu(usize cpu) noexcept {
+#ifdef RB_OS_WIN
+	PROCESSOR_NUMBER number{};
+	number.Group = static_cast<WORD>(cpu / 64);
+	number.Number = static_cast<BYTE>(cpu % 64);
+	USHORT node = 0;
+	return GetNumaProcessorNodeEx(&number, &node) && node != MAXUSHORT ? node : 0;
+#elif defined(RB_OS_LINUX)
+	usize const count = numaNodeCount();
+	for (usize node = 0; node < count && count > 1; ++node) {
+		bool found = false;
+		forEachCpuOfNode(node, [&](usize first, usize last) {
+			found = found || (first <= cpu && cpu <= last);
+		});
+		if (found) {
+			return node;
+		}
+	}
+	return 0;
+#else
+	RB_UNUSED(cpu);
+	return 0;
+#endif
+}
+
+usize memory::currentNumaNode() noexcept {
+#ifdef RB_OS_WIN
+	PROCESSOR_NUMBER number;
+	GetCurrentProcessorNumberEx(&number);
+	USHORT node = 0;
+	return GetNumaProcessorNodeEx(&number, &node) && node != MAXUSHORT ? node : 0;
+#elif defined(RB_OS_LINUX) && defined(SYS_getcpu)
+	unsigned cpu = 0;
+	unsigned node = 0;
+	return syscall(SYS_getcpu, &cpu, &node, nullptr) == 0 ? node : 0;
+#else
+	return 0;
+#endif
+}
+
+bool memory::bindThreadToNumaNode(usize node) noexcept {
+	if (numaNodeCount() <= 1 || node >= numaNodeCount()) {
+		return false;
+	}
+
+#ifdef RB_OS_WIN
+	GROUP_AFFINITY affinity{};
+	if (!GetNumaNodeProcessorMaskEx(static_cast<USHORT>(node), &affinity)) {
+		return false;
+	}
+	// Windows allocates from the node of the ideal processor by default, so affinity is enough
+	return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr);
+#elif defined(RB_OS_LINUX)
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	bool const known = forEachCpuOfNode(node, [&](usize first, usize last) {
+		for (usize cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+			CPU_SET(cpu, &cpus);
+		}
+	});
+	if (!known || CPU_COUNT(&cpus) == 0 || sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+		return false;
+	}
+	#ifdef SYS_set_mempolicy
+	NodeMask const mask(node);
+	// only a preference: the thread may still use remote memory once the node is exhausted
+	syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.words, NodeMask::kMaxNode);
+	#endif
+	return true;
+#else
+	return false;
+#endif
+}
+
+void* impl::numaAllocate(usize bytes, usize node, NumaPolicy policy, MmapOptions options) {
+	if (numaNodeCount() <= 1 || node >= numaNodeCount()) {
+		return mmapAllocate(bytes, options);
+	}
+
+#ifdef RB_OS_WIN
+	RB_UNUSED(policy);
+	void* const ptr = VirtualAllocExNuma(
+	    GetCurrentProcess(), nullptr, bytes == 0 ? 1 : bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE,
+	    static_cast<DWORD>(node));
+	if (!ptr) {
+		return mmapAllocate(bytes, options);
+	}
+	if (options.testFlag(MmapOption::kPopulate)) {
+		auto* const bytePtr = static_cast<unsigned char volatile*>(ptr);
+		for (usize offset = 0; offset < bytes; offset += 4096) {
+			bytePtr[offset] = 0;
+		}
+	}
+	return ptr;
+#else
+	void* const ptr = mmapAllocate(bytes, options);
+	#if defined(RB_OS_LINUX) && defined(SYS_mbind)
+	NodeMask const mask(node);
+	int const mode = policy == NumaPolicy::kBind ? MPOL_BIND : MPOL_PREFERRED;
+	// pre-faulted pages are already placed by the first-touch policy, so they have to be migrated
+	unsigned const flags = options.testFlag(MmapOption::kPopulate) ? MPOL_MF_MOVE : 0;
+	// a failure leaves the mapping with the default policy, which is still usable memory
+	syscall(SYS_mbind, ptr, bytes, mode, mask.words, NodeMask::kMaxNode, flags);
+	#else
+	RB_UNUSED(policy);
+	#endif
+	return ptr;
+#endif
+}
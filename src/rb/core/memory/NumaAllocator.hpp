@@ -0,0 +1,135 @@
+#pragma once
+
+#include <new>
+
+#include <rb/core/attributes.hpp>
+#include <rb/core/export.hpp>
+#include <rb/core/memory/AllocationResult.hpp>
+#include <rb/core/memory/MmapAllocator.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	enum class NumaPolicy : u8 {
+		/// Pages must come from the node; the allocation fails if the node is out of memory.
+		kBind,
+		/// Pages come from the node while it has free memory, and from other nodes otherwise.
+		kPreferred,
+	};
+
+	/// @return number of NUMA nodes of the machine, or 1 if the topology is unknown
+	RB_EXPORT usize numaNodeCount() noexcept;
+
+	/// @return NUMA node the logical CPU @p cpu belongs to, or 0 if the topology is unknown
+	RB_EXPORT usize numaNodeOfCpu(usize cpu) noexcept;
+
+	/// @return NUMA node of the CPU the calling thread is running on, or 0 if unknown
+	RB_EXPORT usize currentNumaNode() noexcept;
+
+	/// Restricts the calling thread to the CPUs of @p node and makes the node preferred for its memory,
+	/// so memory first touched by the thread is node-local.
+	/// @return whether the thread was bound; always `false` on single-node machines, where binding is pointless
+	RB_EXPORT bool bindThreadToNumaNode(usize node) noexcept;
+
+} // namespace memory
+
+namespace impl {
+
+	RB_EXPORT void* numaAllocate(usize bytes, usize node, NumaPolicy policy, MmapOptions options);
+
+} // namespace impl
+
+inline namespace memory {
+
+	RB_WARNING_PUSH
+	RB_WARNING_PADDING
+
+	/**
+	 * NumaAllocator maps memory directly from the OS (see MmapAllocator) and binds it to a NUMA node,
+	 * so worker data lives next to the CPUs which use it regardless of which thread touches it first.
+	 * Binding is done with the `mbind` syscall on Linux and `VirtualAllocExNuma` on Windows;
+	 * on single-node machines, or if the binding fails, it degrades to plain MmapAllocator.
+	 */
+	template <class T>
+	class NumaAllocator {
+		static_assert(alignof(T) <= 4096, "mappings are only page-aligned");
+
+	public:
+		using Value = T;
+		using Size = usize;
+		using Difference = isize;
+
+		constexpr explicit NumaAllocator(
+		    usize node,
+		    NumaPolicy policy = NumaPolicy::kBind,
+		    MmapOptions options = MmapOption::kNone) noexcept
+		    : node_(node)
+		    , options_(options)
+		    , policy_(policy) {
+		}
+
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		template <class U>
+		constexpr NumaAllocator(NumaAllocator<U> const& rhs) noexcept // NOLINT(google-explicit-constructor)
+		    : node_(rhs.node())
+		    , options_(rhs.options())
+		    , policy_(rhs.policy()) {
+		}
+
+		/// Maps `n * sizeof(T)` bytes of zero-filled memory bound to the node.
+		/// @throw std::bad_alloc if the mapping fails
+		[[nodiscard]] RB_ALLOCATOR RB_RETURNS_NONNULL T* allocate(Size n) {
+			RB_CHECK_COMPLETENESS(T);
+			if (n > static_cast<Size>(-1) / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+			return static_cast<T*>(impl::numaAllocate(n * sizeof(T), node_, policy_, options_));
+		}
+
+		[[nodiscard]] AllocationResult<T*> allocateAtLeast(Size n) {
+			return {allocate(n), n};
+		}
+
+		/// Fresh mappings are already zero-filled, see AllocatorTraits::allocateZeroed().
+		[[nodiscard]] T* allocateZeroed(Size n) {
+			return allocate(n);
+		}
+
+		void deallocate(T* ptr, Size n) noexcept {
+			impl::mmapDeallocate(ptr, n * sizeof(T), options_);
+		}
+
+		constexpr usize node() const noexcept {
+			return node_;
+		}
+
+		constexpr NumaPolicy policy() const noexcept {
+			return policy_;
+		}
+
+		constexpr MmapOptions options() const noexcept {
+			return options_;
+		}
+
+	private:
+		usize node_;
+		MmapOptions options_;
+		NumaPolicy policy_;
+	};
+
+	RB_WARNING_POP
+
+	/// Allocators are equal if they place and round blocks the same way.
+	template <class T, class U>
+	constexpr bool operator==(NumaAllocator<T> const& lhs, NumaAllocator<U> const& rhs) noexcept {
+		return lhs.node() == rhs.node() && lhs.policy() == rhs.policy() && lhs.options() == rhs.options();
+	}
+
+	template <class T, class U>
+	constexpr bool operator!=(NumaAllocator<T> const& lhs, NumaAllocator<U> const& rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+} // namespace memory
+} // namespace rb::core
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <atomic>
+
+#include <rb/core/memory/allocators.hpp>
+#include <rb/core/memory/CachePadded.hpp>
+#include <rb/core/memory/construct.hpp>
+#include <rb/core/memory/destroy.hpp>
+#include <rb/core/memory/UniquePtr.hpp>
+#include <rb/core/warnings.hpp>
+
+namespace rb::core {
+
+namespace impl {
+
+	/// Test-and-set lock guarding the shared depot of an ObjectPool;
+	/// critical sections are a handful of pointer swaps, so spinning is cheaper than parking.
+	class PoolLock final {
+	public:
+		void lock() noexcept {
+			while (flag_.test_and_set(std::memory_order_acquire)) {
+			}
+		}
+
+		void unlock() noexcept {
+			flag_.clear(std::memory_order_release);
+		}
+
+	private:
+		std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
+	};
+
+} // namespace impl
+
+inline namespace memory {
+
+	/**
+	 * ObjectPool hands out fixed-size blocks for objects of type @p T.
+	 *
+	 * Blocks are carved from slabs of @p slotsPerSlab slots allocated through ArrayAllocator.
+	 * Each thread keeps a private free-list cache per pool, so the hot allocate/deallocate path takes no lock;
+	 * caches exchange blocks with the shared depot in batches of #kBatchSize.
+	 * Slabs are released when the pool and every thread cache referencing it are gone.
+	 *
+	 * All objects must be returned to the pool before it is destroyed.
+	 */
+	template <class T, usize slotsPerSlab = 64>
+	class ObjectPool final {
+		static_assert(slotsPerSlab > 1, "slab must contain at least one slot besides the header");
+
+		union Slot {
+			Slot* next;
+			alignas(T) unsigned char storage[sizeof(T)];
+		};
+
+		using SlabAllocator = ArrayAllocator<Slot>;
+
+		RB_WARNING_PUSH
+		RB_WARNING_PADDING
+
+		// the lock and the lists it guards share a line, while the reference count (bumped by threads attaching
+		// their caches) lives on its own; the depot itself is aligned so it shares no line with neighbouring heap blocks
+		struct alignas(kHardwareDestructiveInterferenceSize) Depot final {
+			impl::PoolLock lock;
+			Slot* free = nullptr;
+			Slot* slabs = nullptr; // slabs are chained through their first slot
+			std::atomic<bool> alive{true};
+			CachePadded<std::atomic<usize>> refs{1};
+
+			~Depot() {
+				while (slabs) {
+					Slot* const next = slabs->next;
+					SlabAllocator::deallocate(slabs, slotsPerSlab);
+					slabs = next;
+				}
+			}
+
+			void acquire() noexcept {
+				refs->fetch_add(1, std::memory_order_relaxed);
+			}
+
+			void release() noexcept {
+				if (refs->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					delete this;
+				}
+			}
+
+			/// Moves up to @p n slots from the depot (growing it if necessary) into the list @p head.
+			usize pop(Slot*& head, usize n) {
+				lock.lock();
+				if (!free) {
+					try {
+						grow();
+					} catch (...) {
+						lock.unlock();
+						throw;
+					}
+				}
+				usize count = 0;
+				Slot* tail = nullptr;
+				for (Slot* slot = free; slot && count < n; slot = slot->next) {
+					tail = slot;
+					++count;
+				}
+				head = free;
+				free = tail->next;
+				lock.unlock();
+				tail->next = nullptr;
+				return count;
+			}
+
+			/// Returns the chain `[first, last]` to the depot.
+			void push(Slot* first, Slot* last) noexcept {
+				lock.lock();
+				last->next = free;
+				free = first;
+				lock.unlock();
+			}
+
+		private:
+			void grow() {
+				Slot* const slab = SlabAllocator::allocate(slotsPerSlab);
+				slab->next = slabs;
+				slabs = slab;
+				for (usize i = slotsPerSlab - 1; i > 0; --i) {
+					slab[i].next = free;
+					free = slab + i;
+				}
+			}
+		};
+
+		// thread caches are thread-local, so they can't be falsely shared and are left unpadded
+		struct LocalCache final {
+			Depot* depot = nullptr;
+			Slot* head = nullptr;
+			usize count = 0;
+
+			void flush(usize n) noexcept {
+				Slot* const first = head;
+				Slot* last = head;
+				for (usize i = 1; i < n; ++i) {
+					last = last->next;
+				}
+				head = last->next;
+				count -= n;
+				depot->push(first, last);
+			}
+
+			void reset() noexcept {
+				if (count > 0) {
+					flush(count);
+				}
+				depot->release();
+				depot = nullptr;
+			}
+		};
+
+		RB_WARNING_POP
+
+		static constexpr usize kMaxCachedPools = 4;
+
+		struct LocalCaches final {
+			LocalCache entries[kMaxCachedPools];
+
+			~LocalCaches() {
+				for (auto& entry : entries) {
+					if (entry.depot) {
+						entry.reset();
+					}
+				}
+			}
+		};
+
+	public:
+		/// Number of free blocks a thread cache may hold before returning a batch to the depot.
+		static constexpr usize kCacheCapacity = 2 * (slotsPerSlab - 1);
+
+		/// Number of blocks moved between a thread cache and the depot at once.
+		static constexpr usize kBatchSize = slotsPerSlab - 1;
+
+		/// Deleter for UniquePtr which destroys the object and returns its block to the owning pool.
+		struct Deleter {
+			ObjectPool* pool = nullptr;
+
+			void operator()(T* ptr) const noexcept {
+				pool->destroy(ptr);
+			}
+		};
+
+		using Ptr = UniquePtr<T, Deleter>;
+
+		ObjectPool()
+		    : depot_(new Depot) {
+		}
+
+		~ObjectPool() {
+			depot_->alive.store(false, std::memory_order_release);
+			depot_->release();
+		}
+
+		RB_DISABLE_COPY_MOVE(ObjectPool)
+
+		/// Returns uninitialized storage suitable for an object of type @p T.
+		[[nodiscard]] RB_RETURNS_NONNULL T* allocate() {
+			Slot* slot = nullptr;
+			if (LocalCache* cache = localCache()) {
+				if (!cache->head) {
+					cache->count = depot_->pop(cache->head, kBatchSize);
+				}
+				slot = cache->head;
+				cache->head = slot->next;
+				--cache->count;
+			} else {
+				depot_->pop(slot, 1);
+			}
+			return reinterpret_cast<T*>(slot->storage);
+		}
+
+		/// Returns storage obtained from allocate() to the pool; the object must be already destroyed.
+		void deallocate(T* ptr) noexcept {
+			Slot* const slot = reinterpret_cast<Slot*>(ptr);
+			if (LocalCache* cache = localCache()) {
+				slot->next = cache->head;
+				cache->head = slot;
+				if (++cache->count > kCacheCapacity) {
+					cache->flush(kBatchSize);
+				}
+			} else {
+				depot_->push(slot, slot);
+			}
+		}
+
+		/// Destroys the object pointed to by @p ptr and returns its storage to the pool.
+		void destroy(T* ptr) noexcept {
+			core::destroy(ptr);
+			deallocate(ptr);
+		}
+
+		/// Constructs an object of type @p T in a pooled block and wraps it into UniquePtr.
+		template <class... Args>
+		[[nodiscard]] auto make(Args&&... args) -> RB_REQUIRES_RETURN(Ptr, isConstructible<T, Args...>) {
+			T* ptr = allocate();
+			try {
+				construct(ptr, RB_FWD(args)...);
+			} catch (...) {
+				deallocate(ptr);
+				throw;
+			}
+			return Ptr(ptr, Deleter{this});
+		}
+
+	private:
+		/// @return the calling thread's cache for this pool, or `nullptr` if the thread already caches too many pools
+		LocalCache* localCache() noexcept {
+			static thread_local LocalCaches caches;
+
+			LocalCache* vacant = nullptr;
+			for (auto& entry : caches.entries) {
+				if (entry.depot == depot_) {
+					return &entry;
+				}
+				if (entry.depot && !entry.depot->alive.load(std::memory_order_acquire)) {
+					entry.reset();
+				}
+				if (!entry.depot && !vacant) {
+					vacant = &entry;
+				}
+			}
+			if (vacant) {
+				depot_->acquire();
+				vacant->depot = depot_;
+			}
+			return vacant;
+		}
+
+		Depot* depot_;
+	};
+
+} // namespace memory
+} // namespace rb::core
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <new>
+
+#include <rb/core/assert.hpp>
+#include <rb/core/memory/AllocationResult.hpp>
+#include <rb/core/memory/MemoryResource.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	/**
+	 * PolymorphicAllocator allocates memory from the MemoryResource it was constructed with,
+	 * so containers with different memory resources share the same static type.
+	 */
+	template <class T>
+	class PolymorphicAllocator {
+	public:
+		using Value = T;
+		using Size = usize;
+		using Difference = isize;
+
+		/// Constructs PolymorphicAllocator using defaultResource().
+		PolymorphicAllocator() noexcept
+		    : resource_(defaultResource()) {
+		}
+
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		PolymorphicAllocator(MemoryResource* resource) // NOLINT(google-explicit-constructor)
+		    : resource_(resource) {
+			RB_ASSERT_MSG("resource must not be null", resource);
+		}
+
+		PolymorphicAllocator(PolymorphicAllocator const&) noexcept = default;
+
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		template <class U>
+		PolymorphicAllocator(PolymorphicAllocator<U> const& rhs) noexcept // NOLINT(google-explicit-constructor)
+		    : resource_(rhs.resource()) {
+		}
+
+		PolymorphicAllocator& operator=(PolymorphicAllocator const&) = delete;
+
+		[[nodiscard]] T* allocate(Size n) {
+			RB_CHECK_COMPLETENESS(T);
+			if (n > static_cast<Size>(-1) / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+			return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		[[nodiscard]] AllocationResult<T*> allocateAtLeast(Size n) {
+			return {allocate(n), n};
+		}
+
+		void deallocate(T* ptr, Size n) {
+			resource_->deallocate(ptr, n * sizeof(T), alignof(T));
+		}
+
+		MemoryResource* resource() const noexcept {
+			return resource_;
+		}
+
+	private:
+		MemoryResource* resource_;
+	};
+
+	template <class T, class U>
+	bool operator==(PolymorphicAllocator<T> const& lhs, PolymorphicAllocator<U> const& rhs) noexcept {
+		return *lhs.resource() == *rhs.resource();
+	}
+
+	template <class T, class U>
+	bool operator!=(PolymorphicAllocator<T> const& lhs, PolymorphicAllocator<U> const& rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+} // namespace memory
+} // namespace rb::core
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <ostream>
+
+#include <rb/core/assert.hpp>
+#include <rb/core/memory/RefCounted.hpp>
+#include <rb/core/swap.hpp>
+#include <rb/core/traits/IsConvertible.hpp>
+#include <rb/core/traits/IsRef.hpp>
+#include <rb/core/traits/requirements.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	/**
+	 * RcPtr is a smart pointer to an intrusively reference-counted object (see RefCounted).
+	 * It is exactly one pointer wide; copying it costs a single increment of the embedded counter.
+	 */
+	template <class T>
+	class RcPtr final {
+	public:
+		using Element = T;
+
+		constexpr RcPtr() noexcept = default;
+
+		// NOLINTBEGIN(google-explicit-constructor)
+
+		constexpr RcPtr(std::nullptr_t /*nullptr*/) noexcept {
+		}
+
+		/// Shares ownership of @p ptr, incrementing its reference count.
+		explicit RcPtr(T* ptr) noexcept
+		    : ptr_(ptr) {
+			if (ptr_) {
+				ptr_->retain();
+			}
+		}
+
+		RcPtr(RcPtr const& rhs) noexcept
+		    : RcPtr(rhs.ptr_) {
+		}
+
+		RcPtr(RcPtr&& rhs) noexcept
+		    : ptr_(rhs.ptr_) {
+			rhs.ptr_ = nullptr;
+		}
+
+		template <class U,
+		    RB_REQUIRES(isConvertible<U*, T*>)>
+		RcPtr(RcPtr<U> const& rhs) noexcept
+		    : RcPtr(rhs.get()) {
+		}
+
+		template <class U,
+		    RB_REQUIRES(isConvertible<U*, T*>)>
+		RcPtr(RcPtr<U>&& rhs) noexcept
+		    : ptr_(rhs.detach()) {
+		}
+
+		// NOLINTEND(google-explicit-constructor)
+
+		~RcPtr() {
+			if (ptr_) {
+				ptr_->release();
+			}
+		}
+
+		RcPtr& operator=(RcPtr const& rhs) noexcept {
+			RcPtr(rhs).swap(*this);
+			return *this;
+		}
+
+		RcPtr& operator=(RcPtr&& rhs) noexcept {
+			RcPtr(RB_MOVE(rhs)).swap(*this);
+			return *this;
+		}
+
+		RcPtr& operator=(std::nullptr_t) noexcept {
+			reset();
+			return *this;
+		}
+
+		constexpr explicit operator bool() const noexcept {
+			return ptr_;
+		}
+
+		T& operator*() const {
+			RB_ASSERT_MSG("dereference null", ptr_);
+			return *ptr_;
+		}
+
+		T* operator->() const {
+			RB_ASSERT_MSG("dereference null", ptr_);
+			return ptr_;
+		}
+
+		constexpr T* get() const noexcept {
+			return ptr_;
+		}
+
+		/// @return number of RcPtr instances sharing the object, or 0 if @c this is null.
+		usize useCount() const noexcept {
+			return ptr_ ? ptr_->useCount() : 0;
+		}
+
+		void reset() noexcept {
+			RcPtr().swap(*this);
+		}
+
+		constexpr void swap(RcPtr& rhs) noexcept {
+			core::swap(ptr_, rhs.ptr_);
+		}
+
+	private:
+		template <class U>
+		friend class RcPtr;
+
+		/// Releases the ownership without decrementing the count.
+		T* detach() noexcept {
+			T* const ptr = ptr_;
+			ptr_ = nullptr;
+			return ptr;
+		}
+
+		T* ptr_ = nullptr;
+	};
+
+	/// Constructs an object of type @p T in a single allocation (the count is embedded) and wraps it into RcPtr.
+	template <class T, class... Args,
+	    RB_REQUIRES_T(IsConstructible<T, Args...>)>
+	RcPtr<T> makeRc(Args&&... args) {
+		return RcPtr<T>(new T(RB_FWD(args)...));
+	}
+
+	template <class T, class U>
+	bool operator==(RcPtr<T> const& lhs, RcPtr<U> const& rhs) noexcept {
+		return lhs.get() == rhs.get();
+	}
+
+	template <class T, class U>
+	bool operator!=(RcPtr<T> const& lhs, RcPtr<U> const& rhs) noexcept {
+		return lhs.get() != rhs.get();
+	}
+
+	template <class T>
+	bool operator==(RcPtr<T> const& lhs, std::nullptr_t /*rhs*/) noexcept {
+		return !lhs;
+	}
+
+	template <class T>
+	bool operator!=(RcPtr<T> const& lhs, std::nullptr_t /*rhs*/) noexcept {
+		return static_cast<bool>(lhs);
+	}
+
+	template <class Char, class Traits, class T,
+	    RB_REQUIRES_T(IsWritableTo<AddLValueRef<T const>, std::basic_ostream<Char, Traits>>)>
+	std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& os, RcPtr<T> const& ptr) {
+		return ptr
+		    ? os << os.widen('&') << *ptr
+		    : os << os.widen('n') << os.widen('u') << os.widen('l') << os.widen('l');
+	}
+
+} // namespace memory
+
+template <class T>
+constexpr void swap(RcPtr<T>& lhs, RcPtr<T>& rhs) noexcept {
+	lhs.swap(rhs);
+}
+
+} // namespace rb::core
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+
+#include <rb/core/types.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	/// Reference counting policy for objects shared between threads.
+	class AtomicCounting final {
+	public:
+		void increment() noexcept {
+			count_.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/// @return whether the count dropped to zero
+		bool decrement() noexcept {
+			return count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+		}
+
+		usize load() const noexcept {
+			return count_.load(std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<usize> count_{0};
+	};
+
+	/// Reference counting policy for objects confined to a single thread.
+	class NonAtomicCounting final {
+	public:
+		void increment() noexcept {
+			++count_;
+		}
+
+		/// @return whether the count dropped to zero
+		bool decrement() noexcept {
+			return --count_ == 0;
+		}
+
+		usize load() const noexcept {
+			return count_;
+		}
+
+	private:
+		usize count_ = 0;
+	};
+
+	/**
+	 * Base class (CRTP) for objects managed by RcPtr: the reference count lives inside the object,
+	 * so there is no separate control block.
+	 * When the last reference is released, the object is destroyed with `delete static_cast<T*>(this)`.
+	 *
+	 * @tparam T The derived class.
+	 * @tparam Policy AtomicCounting or NonAtomicCounting.
+	 */
+	template <class T, class Policy = AtomicCounting>
+	class RefCounted {
+	public:
+		void retain() const noexcept {
+			counter_.increment();
+		}
+
+		void release() const noexcept {
+			if (counter_.decrement()) {
+				delete static_cast<T const*>(this);
+			}
+		}
+
+		usize useCount() const noexcept {
+			return counter_.load();
+		}
+
+	protected:
+		constexpr RefCounted() noexcept = default;
+
+		// the counter is a property of the object identity, so it's never copied
+		constexpr RefCounted(RefCounted const& /*rhs*/) noexcept {
+		}
+
+		constexpr RefCounted& operator=(RefCounted const& /*rhs*/) noexcept {
+			return *this;
+		}
+
+		~RefCounted() = default;
+
+	private:
+		mutable Policy counter_;
+	};
+
+} // namespace memory
+} // namespace rb::core
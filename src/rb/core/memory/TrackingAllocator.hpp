@@ -0,0 +1,84 @@
+#pragma once
+
+#include <rb/core/memory/AllocationTracker.hpp>
+#include <rb/core/memory/AllocatorTraits.hpp>
+#include <rb/core/memory/EmptyBase.hpp>
+
+namespace rb::core {
+inline namespace memory {
+
+	/**
+	 * TrackingAllocator forwards to @p A and reports every allocation and deallocation
+	 * to AllocationTracker::global().
+	 * Allocations are attributed to the innermost AllocationTracker::Scope of the thread if there is one,
+	 * otherwise to the direct caller of allocate(). For containers the direct caller is always AllocatorTraits,
+	 * so their call sites are marked with scopes.
+	 */
+	template <class A>
+	class TrackingAllocator : EmptyBase<A> {
+		using Super = EmptyBase<A>;
+		using Traits = AllocatorTraits<A>;
+
+	public:
+		using Value = typename Traits::Value;
+		using Pointer = typename Traits::Pointer;
+		using Size = typename Traits::Size;
+		using Difference = typename Traits::Difference;
+		using IsAlwaysEqual = typename Traits::IsAlwaysEqual;
+		using PropagateOnContainerCopyAssignment = typename Traits::PropagateOnContainerCopyAssignment;
+		using PropagateOnContainerMoveAssignment = typename Traits::PropagateOnContainerMoveAssignment;
+		using PropagateOnContainerSwap = typename Traits::PropagateOnContainerSwap;
+
+		template <class U>
+		using Rebind = TrackingAllocator<typename Traits::template RebindAlloc<U>>;
+
+		constexpr TrackingAllocator() noexcept(isNothrowDefaultConstructible<A>) = default;
+
+		constexpr explicit TrackingAllocator(A const& inner) noexcept(isNothrowCopyConstructible<A>)
+		    : Super(inner) {
+		}
+
+		// ReSharper disable once CppNonExplicitConvertingConstructor
+		template <class B>
+		constexpr TrackingAllocator(TrackingAllocator<B> const& rhs) // NOLINT(google-explicit-constructor)
+		    : Super(A(rhs.inner())) {
+		}
+
+		[[nodiscard]] Pointer allocate(Size n, RB_SOURCE_LOCATION_DECL) {
+			Pointer ptr = nullptr;
+			{
+				// don't let the allocation hooks (if any) count the inner allocation twice
+				AllocationTracker::Pause const pause;
+				ptr = Traits::allocate(inner(), n);
+			}
+			AllocationTracker::global().recordAllocation(n * sizeof(Value), location);
+			return ptr;
+		}
+
+		void deallocate(Pointer ptr, Size n) {
+			AllocationTracker::global().recordDeallocation(n * sizeof(Value));
+			AllocationTracker::Pause const pause;
+			Traits::deallocate(inner(), ptr, n);
+		}
+
+		constexpr A const& inner() const noexcept {
+			return Super::get();
+		}
+
+		constexpr A& inner() noexcept {
+			return Super::get();
+		}
+	};
+
+	template <class A, class B>
+	bool operator==(TrackingAllocator<A> const& lhs, TrackingAllocator<B> const& rhs) {
+		return lhs.inner() == rhs.inner();
+	}
+
+	template <class A, class B>
+	bool operator!=(TrackingAllocator<A> const& lhs, TrackingAllocator<B> const& rhs) {
+		return !(lhs == rhs);
+	}
+
+} // namespace memory
+} // namespace rb::core
@@ -36,6 +36,12 @@ inline namespace memory {
 	template <class T>
 	class OwnerPtr;
 
+	template <class T, usize slotsPerSlab>
+	class ObjectPool;
+
+	template <class Alloc>
+	class AllocDeleter;
+
 	/**
 	 * UniquePtr is a smart pointer that owns and manages another object through a pointer
 	 * and disposes of that object when the UniquePtr goes out of scope.
@@ -144,8 +150,9 @@ inline namespace memory {
 
 		// NOLINTBEGIN(*-c-copy-assignment-signature,*-unconventional-assign-operator)
 
+		template <class DD = D>
 		auto operator=(UniquePtr&& rhs) noexcept
-		    -> RB_REQUIRES_RETURN(UniquePtr&, isMoveAssignable<D>) {
+		    -> RB_REQUIRES_RETURN(UniquePtr&, isMoveAssignable<DD>) {
 			if (this != &rhs) {
 				reset(rhs.release());
 				deleter() = RB_MOVE(rhs.deleter());
@@ -225,6 +232,12 @@ inline namespace memory {
 		template <class U>
 		friend class OwnerPtr;
 
+		template <class U, usize _>
+		friend class ObjectPool;
+
+		template <class Alloc>
+		friend class AllocDeleter;
+
 		template <class U, class _>
 		friend class UniquePtr;
 
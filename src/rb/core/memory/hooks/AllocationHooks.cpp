@@ -0,0 +1,173 @@
+// Replacement of the global allocation functions which reports to AllocationTracker.
+// Built as the separate `Rb::AllocationHooks` target: link it to the executable to enable the hooks.
+
+#include <cstdlib>
+#include <new>
+
+#include <rb/core/memory/AllocationTracker.hpp>
+#include <rb/core/os.hpp>
+
+#ifdef RB_OS_WIN
+	#include <malloc.h>
+#endif
+
+using namespace rb::core;
+
+namespace {
+
+constexpr usize kDefaultAlign = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+// Every block is prefixed with a header keeping the requested size and the header size,
+// so unsized `operator delete` can report the number of released bytes.
+static_assert(kDefaultAlign >= 2 * sizeof(usize), "header doesn't fit");
+
+void* tryAllocate(usize bytes, usize align) noexcept {
+	usize const header = align < kDefaultAlign ? kDefaultAlign : align;
+	if (bytes > static_cast<usize>(-1) - 2 * header) {
+		return nullptr;
+	}
+
+	void* raw = nullptr;
+#ifdef RB_OS_WIN
+	raw = _aligned_malloc(bytes + header, header);
+#else
+	if (header == kDefaultAlign) {
+		raw = std::malloc(bytes + header);
+	} else {
+		usize const total = (bytes + header + align - 1) / align * align;
+		raw = std::aligned_alloc(align, total);
+	}
+#endif
+	if (!raw) {
+		return nullptr;
+	}
+
+	auto* const ptr = static_cast<unsigned char*>(raw) + header;
+	reinterpret_cast<usize*>(ptr)[-1] = bytes;
+	reinterpret_cast<usize*>(ptr)[-2] = header;
+	AllocationTracker::global().recordAllocation(bytes);
+	return ptr;
+}
+
+void* allocate(usize bytes, usize align) {
+	for (;;) {
+		if (void* ptr = tryAllocate(bytes == 0 ? 1 : bytes, align)) {
+			return ptr;
+		}
+		std::new_handler const handler = std::get_new_handler();
+		if (!handler) {
+			throw std::bad_alloc();
+		}
+		handler();
+	}
+}
+
+void* allocate(usize bytes, usize align, std::nothrow_t const& /*tag*/) noexcept {
+	try {
+		return allocate(bytes, align);
+	} catch (...) {
+		return nullptr;
+	}
+}
+
+void deallocate(void* ptr) noexcept {
+	if (!ptr) {
+		return;
+	}
+
+	usize const bytes = static_cast<usize*>(ptr)[-1];
+	usize const header = static_cast<usize*>(ptr)[-2];
+	AllocationTracker::global().recordDeallocation(bytes);
+	void* const raw = static_cast<unsigned char*>(ptr) - header;
+#ifdef RB_OS_WIN
+	_aligned_free(raw);
+#else
+	std::free(raw);
+#endif
+}
+
+} // namespace
+
+// NOLINTBEGIN(*-new-delete-overloads)
+
+void* operator new(usize bytes) {
+	return allocate(bytes, kDefaultAlign);
+}
+
+void* operator new[](usize bytes) {
+	return allocate(bytes, kDefaultAlign);
+}
+
+void* operator new(usize bytes, std::nothrow_t const& tag) noexcept {
+	return allocate(bytes, kDefaultAlign, tag);
+}
+
+void* operator new[](usize bytes, std::nothrow_t const& tag) noexcept {
+	return allocate(bytes, kDefaultAlign, tag);
+}
+
+void* operator new(usize bytes, std::align_val_t align) {
+	return allocate(bytes, static_cast<usize>(align));
+}
+
+void* operator new[](usize bytes, std::align_val_t align) {
+	return allocate(bytes, static_cast<usize>(align));
+}
+
+void* operator new(usize bytes, std::align_val_t align, std::nothrow_t const& tag) noexcept {
+	return allocate(bytes, static_cast<usize>(align), tag);
+}
+
+void* operator new[](usize bytes, std::align_val_t align, std::nothrow_t const& tag) noexcept {
+	return allocate(bytes, static_cast<usize>(align), tag);
+}
+
+void operator delete(void* ptr) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete(void* ptr, usize /*bytes*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete[](void* ptr, usize /*bytes*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::nothrow_t const& /*tag*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::nothrow_t const& /*tag*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*align*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*align*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete(void* ptr, usize /*bytes*/, std::align_val_t /*align*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete[](void* ptr, usize /*bytes*/, std::align_val_t /*align*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*align*/, std::nothrow_t const& /*tag*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*align*/, std::nothrow_t const& /*tag*/) noexcept {
+	deallocate(ptr);
+}
+
+// NOLINTEND(*-new-delete-overloads)
@@ -2,17 +2,31 @@
 
 #include <rb/core/memory/addressOf.hpp>
 #include <rb/core/memory/AllocationResult.hpp>
+#include <rb/core/memory/AllocationTracker.hpp>
+#include <rb/core/memory/AllocUniquePtr.hpp>
 #include <rb/core/memory/Allocator.hpp>
 #include <rb/core/memory/allocators.hpp>
 #include <rb/core/memory/AllocatorTraits.hpp>
+#include <rb/core/memory/CachePadded.hpp>
 #include <rb/core/memory/CompressedPair.hpp>
 #include <rb/core/memory/construct.hpp>
 #include <rb/core/memory/DefaultDeleter.hpp>
 #include <rb/core/memory/destroy.hpp>
 #include <rb/core/memory/EmptyBase.hpp>
+#include <rb/core/memory/EpochManager.hpp>
+#include <rb/core/memory/HazardPointer.hpp>
 #include <rb/core/memory/helpers.hpp>
+#include <rb/core/memory/InlineArena.hpp>
+#include <rb/core/memory/MemoryResource.hpp>
+#include <rb/core/memory/MmapAllocator.hpp>
+#include <rb/core/memory/NumaAllocator.hpp>
+#include <rb/core/memory/ObjectPool.hpp>
 #include <rb/core/memory/OwnerPtr.hpp>
 #include <rb/core/memory/PointerTraits.hpp>
+#include <rb/core/memory/PolymorphicAllocator.hpp>
+#include <rb/core/memory/RcPtr.hpp>
+#include <rb/core/memory/RefCounted.hpp>
 #include <rb/core/memory/toAddress.hpp>
+#include <rb/core/memory/TrackingAllocator.hpp>
 #include <rb/core/memory/UniquePtr.hpp>
 #include <rb/core/memory/Wrapper.hpp>
@@ -15,9 +15,12 @@
 #include <rb/core/bits.hpp>
 #include <rb/core/builtins.hpp>
 #include <rb/core/byte.hpp>
+#include <rb/core/byteOrder.hpp>
 #include <rb/core/compiler.hpp>
 #include <rb/core/CompilerInfo.hpp>
+#include <rb/core/CpuFeatures.hpp>
 #include <rb/core/decayCopy.hpp>
+#include <rb/core/Divider.hpp>
 #include <rb/core/endian.hpp>
 #include <rb/core/enums.hpp>
 #include <rb/core/ErrorCode.hpp>
@@ -26,6 +29,7 @@
 #include <rb/core/export.hpp>
 #include <rb/core/features.hpp>
 #include <rb/core/Flags.hpp>
+#include <rb/core/FunctionRef.hpp>
 #include <rb/core/helpers.hpp>
 #include <rb/core/InPlace.hpp>
 #include <rb/core/int128.hpp>
@@ -33,16 +37,22 @@
 #include <rb/core/keywords.hpp>
 #include <rb/core/limits.hpp>
 #include <rb/core/move.hpp>
+#include <rb/core/NicheTraits.hpp>
 #include <rb/core/Option.hpp>
 #include <rb/core/os.hpp>
 #include <rb/core/processor.hpp>
 #include <rb/core/quorem.hpp>
 #include <rb/core/requires.hpp>
 #include <rb/core/sanitizers.hpp>
+#include <rb/core/Simd.hpp>
 #include <rb/core/SourceLocation.hpp>
 #include <rb/core/Span.hpp>
 #include <rb/core/swap.hpp>
+#include <rb/core/Tuple.hpp>
+#include <rb/core/TypeId.hpp>
 #include <rb/core/types.hpp>
+#include <rb/core/UniqueFunction.hpp>
+#include <rb/core/Variant.hpp>
 #include <rb/core/Version.hpp>
 #include <rb/core/warnings.hpp>
 
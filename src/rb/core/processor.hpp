@@ -170,3 +170,31 @@
 	#define RB_IS_32BIT 1
 	#define RB_IS_64BIT 0
 #endif
+
+/*
+ * Minimum offset between two objects to avoid false sharing (destructive interference),
+ * and maximum size of contiguous memory to promote true sharing (constructive interference).
+ * These are not taken from std::hardware_destructive_interference_size, which is ABI-unstable and not
+ * provided by every standard library.
+ * - Apple ARM64 (M-series) cores use 128-byte cache lines
+ * - other ARM64 cores use 64-byte lines, but Cortex-A/Neoverse prefetchers pull pairs of lines,
+ *   so 128 bytes are also used for the destructive size there
+ * - POWER7+ uses 128-byte lines, and z/Architecture uses 256-byte lines
+ * - x86 and everything else is assumed to use 64-byte lines
+ */
+#if defined(RB_PROCESSOR_ARM_64) && defined(__APPLE__)
+	#define RB_DESTRUCTIVE_INTERFERENCE_SIZE 128
+	#define RB_CONSTRUCTIVE_INTERFERENCE_SIZE 128
+#elif defined(RB_PROCESSOR_ARM_64)
+	#define RB_DESTRUCTIVE_INTERFERENCE_SIZE 128
+	#define RB_CONSTRUCTIVE_INTERFERENCE_SIZE 64
+#elif defined(RB_PROCESSOR_POWER_64)
+	#define RB_DESTRUCTIVE_INTERFERENCE_SIZE 128
+	#define RB_CONSTRUCTIVE_INTERFERENCE_SIZE 128
+#elif defined(RB_PROCESSOR_S390)
+	#define RB_DESTRUCTIVE_INTERFERENCE_SIZE 256
+	#define RB_CONSTRUCTIVE_INTERFERENCE_SIZE 256
+#else
+	#define RB_DESTRUCTIVE_INTERFERENCE_SIZE 64
+	#define RB_CONSTRUCTIVE_INTERFERENCE_SIZE 64
+#endif
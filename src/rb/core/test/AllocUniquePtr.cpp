@@ -0,0 +1,24 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/core/memory/AllocUniquePtr.hpp>
+#include <rb/core/memory/Allocator.hpp>
+#include <rb/core/memory/PolymorphicAllocator.hpp>
+
+using namespace rb::core;
+
+TEST_CASE("Stateless", "[core::AllocUniquePtr]") {
+	auto const ptr = makeUniqueWithAllocator<int>(Allocator<char>{}, 42);
+	STATIC_REQUIRE(sizeof(ptr) == sizeof(int*));
+	REQUIRE(*ptr == 42);
+}
+
+TEST_CASE("Stateful", "[core::AllocUniquePtr]") {
+	PolymorphicAllocator<char> const alloc(newDeleteResource());
+	auto ptr = makeUniqueWithAllocator<int>(alloc, 42);
+	REQUIRE(*ptr == 42);
+	REQUIRE(ptr.deleter().allocator() == alloc);
+	REQUIRE_THROWS_AS(makeUniqueWithAllocator<int>(PolymorphicAllocator<char>(nullResource()), 0), std::bad_alloc);
+
+	OwnerPtr<int> const owner = makeOwnerWithAllocator<int>(alloc, 7);
+	REQUIRE(*owner == 7);
+}
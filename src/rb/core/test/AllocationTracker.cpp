@@ -0,0 +1,75 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/containers/Vector.hpp>
+#include <rb/core/memory/Allocator.hpp>
+#include <rb/core/memory/TrackingAllocator.hpp>
+
+using namespace rb::core;
+using namespace rb::containers;
+
+TEST_CASE("allocationsDuring", "[core::AllocationTracker]") {
+	Vector<int, TrackingAllocator<Allocator<int>>> v(4);
+	REQUIRE(allocationsDuring([&] {
+		v[0] = 1;
+		v.reserve(4);
+	}) == 0);
+	REQUIRE(allocationsDuring([&] {
+		v.reserve(16);
+	}) == 1);
+	// the hooks replacing global operator new are only linked into their own tests
+	REQUIRE(allocationsDuring([] {
+		delete new int(0);
+	}) == 0);
+}
+
+TEST_CASE("CallSite", "[core::AllocationTracker]") {
+	auto& tracker = AllocationTracker::global();
+	tracker.reset();
+	auto const before = tracker.snapshot().liveBytes;
+
+	TrackingAllocator<Allocator<u64>> alloc;
+	auto const line = __LINE__ + 1;
+	u64* const ptr = alloc.allocate(100);
+
+	auto snapshot = tracker.snapshot();
+	REQUIRE(snapshot.liveBytes - before == 800);
+	REQUIRE(snapshot.peakBytes >= snapshot.liveBytes);
+	REQUIRE(snapshot.sizeClasses[AllocationTracker::sizeClassOf(800)] >= 1);
+	REQUIRE(snapshot.callSiteCount == 1);
+	REQUIRE(snapshot.callSites[0].location.line() == line);
+	REQUIRE(snapshot.callSites[0].bytes == 800);
+
+	alloc.deallocate(ptr, 100);
+	snapshot = tracker.snapshot();
+	REQUIRE(snapshot.liveBytes == before);
+}
+
+TEST_CASE("Scope", "[core::AllocationTracker]") {
+	auto& tracker = AllocationTracker::global();
+	tracker.reset();
+
+	Vector<int, TrackingAllocator<Allocator<int>>> first;
+	Vector<u64, TrackingAllocator<Allocator<u64>>> second;
+	unsigned firstLine = 0;
+	unsigned secondLine = 0;
+	{
+		firstLine = __LINE__ + 1;
+		AllocationTracker::Scope const scope;
+		first.reserve(4);
+		first.reserve(8);
+	}
+	{
+		secondLine = __LINE__ + 1;
+		AllocationTracker::Scope const scope;
+		second.reserve(2);
+	}
+
+	auto const snapshot = tracker.snapshot();
+	REQUIRE(snapshot.callSiteCount == 2);
+	REQUIRE(snapshot.callSites[0].location.line() == firstLine);
+	REQUIRE(snapshot.callSites[0].allocations == 2);
+	REQUIRE(snapshot.callSites[0].bytes == 12 * sizeof(int));
+	REQUIRE(snapshot.callSites[1].location.line() == secondLine);
+	REQUIRE(snapshot.callSites[1].allocations == 1);
+	REQUIRE(snapshot.callSites[1].bytes == 2 * sizeof(u64));
+}
@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+
+#include <rb/core/Any.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+struct Small {
+	void* data[3] = {};
+};
+
+struct Big {
+	u64 data[8] = {};
+};
+
+struct X {
+	int value = 0;
+};
+
+} // namespace
+
+// defined in test/AnyOtherUnit.cpp
+Any makeAnyOfOtherUnit();
+
+TEST_CASE("Inline", "[core::Any]") {
+	static_assert(sizeof(Any) == 4 * sizeof(void*));
+	static_assert(Any::kStoredInline<int> && Any::kStoredInline<Small>);
+	static_assert(!Any::kStoredInline<Big>);
+
+	Any a(42);
+	Any b = a;
+	REQUIRE(*cast<int>(&b) == 42);
+	REQUIRE_FALSE(cast<long>(&b));
+
+	Any c = RB_MOVE(a);
+	REQUIRE_FALSE(a);
+	REQUIRE(*cast<int>(&c) == 42);
+
+	c.emplace<std::string>("a string long enough to defeat the short string optimization");
+	std::ostringstream os;
+	os << c;
+	REQUIRE(os.str() == *cast<std::string>(&c));
+}
+
+TEST_CASE("Heap", "[core::Any]") {
+	Any a(kInPlaceType<Big>);
+	cast<Big>(&a)->data[7] = 7;
+	Any b(std::string("x"));
+	a.swap(b);
+	REQUIRE(*cast<std::string>(&a) == "x");
+	REQUIRE(cast<Big>(&b)->data[7] == 7);
+
+	b = a;
+	REQUIRE(*cast<std::string>(&b) == "x");
+	b.reset();
+	REQUIRE_FALSE(b.hasValue());
+}
+
+TEST_CASE("Visit", "[core::Any]") {
+	static_assert(kTypeId<int const&> == kTypeId<int>);
+	static_assert(kTypeId<int> != kTypeId<long>);
+	REQUIRE(TypeId::of<Big>().name().find("Big") != std::string_view::npos);
+
+	auto const describe = [](Any const& any) {
+		return visit<int, std::string, Big>(any, [](auto const& value) -> std::string {
+			using T = RemoveCvRef<decltype(value)>;
+			if constexpr (isSame<T, int>) {
+				return "int " + std::to_string(value);
+			} else if constexpr (isSame<T, std::string>) {
+				return "string " + value;
+			} else if constexpr (isSame<T, Big>) {
+				return "big";
+			} else {
+				return "none";
+			}
+		});
+	};
+	REQUIRE(describe(Any(7)) == "int 7");
+	REQUIRE(describe(Any(std::string("x"))) == "string x");
+	REQUIRE(describe(Any(Big{})) == "big");
+	REQUIRE(describe(Any(1.0)) == "none");
+	REQUIRE(describe(Any()) == "none");
+
+	Any a(1);
+	visit<int>(a, [](auto& value) {
+		if constexpr (isSame<decltype(value), int&>) {
+			++value;
+		}
+	});
+	REQUIRE(a.typeId() == kTypeId<int>);
+	REQUIRE(*cast<int>(&a) == 2);
+}
+
+TEST_CASE("Type identity", "[core::Any]") {
+	// both types are named `{anonymous}::X`, so their TypeIds are equal
+	Any a = makeAnyOfOtherUnit();
+	REQUIRE(a.typeId() == kTypeId<X>);
+	REQUIRE_FALSE(cast<X>(&a));
+	REQUIRE(visit<X>(a, [](auto const& value) { return isSame<RemoveCvRef<decltype(value)>, X>; }) == false);
+
+	Any b(X{});
+	REQUIRE(cast<X>(&b));
+}
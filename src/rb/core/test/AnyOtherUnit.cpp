@@ -0,0 +1,16 @@
+#include <rb/core/Any.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+// spelled like the `X` of test/Any.cpp, but a different type
+struct X {
+	u64 data[9] = {};
+};
+
+} // namespace
+
+Any makeAnyOfOtherUnit() {
+	return Any(X{});
+}
@@ -0,0 +1,24 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+
+#include <rb/core/memory/CachePadded.hpp>
+
+using namespace rb::core;
+
+static_assert(alignof(CachePadded<char>) == kHardwareDestructiveInterferenceSize);
+static_assert(sizeof(CachePadded<char>) == kHardwareDestructiveInterferenceSize);
+static_assert(sizeof(CachePadded<char[kHardwareDestructiveInterferenceSize + 1]>) == 2 * kHardwareDestructiveInterferenceSize);
+
+TEST_CASE("Layout", "[core::CachePadded]") {
+	CachePadded<std::atomic<int>> counters[2];
+	counters[0]->store(1);
+	*counters[1] = 2;
+	REQUIRE(counters[0]->load() + counters[1]->load() == 3);
+
+	auto const distance = reinterpret_cast<char const*>(&counters[1].get()) - reinterpret_cast<char const*>(&counters[0].get());
+	REQUIRE(static_cast<usize>(distance) >= kHardwareDestructiveInterferenceSize);
+
+	CachePadded<int> const value = 42;
+	REQUIRE(*value == 42);
+}
@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/core/CpuFeatures.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+// no CPU implements both x86 and ARM extensions
+constexpr CpuFeatures kImpossible = {CpuFeature::kSse2, CpuFeature::kNeon};
+
+int scalar() noexcept {
+	return 0;
+}
+
+int unsupported() noexcept {
+	return 1;
+}
+
+int generic() noexcept {
+	return 2;
+}
+
+} // namespace
+
+TEST_CASE("Detection", "[core::CpuFeatures]") {
+	CpuFeatures const features = cpuFeatures();
+	REQUIRE(features == cpuFeatures());
+
+	// whatever the compiler is allowed to use must be supported by the CPU the test runs on
+#if defined(__SSE2__) || defined(_M_X64)
+	REQUIRE(features.testFlag(CpuFeature::kSse2));
+#endif
+#ifdef __SSE4_2__
+	REQUIRE(features.testFlag(CpuFeature::kSse42));
+#endif
+#ifdef __AVX2__
+	REQUIRE(features.testFlag(CpuFeature::kAvx2));
+#endif
+#ifdef __AVX512F__
+	REQUIRE(features.testFlag(CpuFeature::kAvx512F));
+#endif
+#ifdef __BMI2__
+	REQUIRE(features.testFlag(CpuFeature::kBmi2));
+#endif
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+	REQUIRE(features.testFlag(CpuFeature::kNeon));
+#endif
+
+	REQUIRE(hasCpuFeatures({}));
+	if (features.testFlag(CpuFeature::kAvx2)) {
+		REQUIRE(features.testFlag(CpuFeature::kAvx));
+	}
+	REQUIRE_FALSE(hasCpuFeatures(kImpossible));
+}
+
+TEST_CASE("Multiversioning", "[core::CpuFeatures]") {
+	REQUIRE(RB_MULTIVERSION(scalar, {kImpossible, unsupported})() == 0);
+	REQUIRE(RB_MULTIVERSION(scalar, {kImpossible, unsupported}, {CpuFeatures{}, generic})() == 2);
+
+	for (int i = 0; i < 2; ++i) {
+		REQUIRE(RB_MULTIVERSION(scalar, {CpuFeatures{}, generic}, {kImpossible, unsupported})() == 2);
+	}
+}
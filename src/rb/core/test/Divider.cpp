@@ -0,0 +1,71 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/core/Divider.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+template <class T>
+T next(u64& state) noexcept {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return static_cast<T>(state);
+}
+
+template <class T, bool kBranchFree>
+void check(T divisor, u64& state) {
+	Divider<T, kBranchFree> const divider(divisor);
+	T const edges[] = {0, 1, 2, divisor, static_cast<T>(divisor / 2), max<T>, static_cast<T>(max<T> - 1), min<T>};
+	for (T const dividend : edges) {
+		if (isSigned<T> && dividend == min<T> && divisor == T(-1)) {
+			continue;
+		}
+		REQUIRE(dividend / divider == dividend / divisor);
+		REQUIRE(dividend % divider == dividend % divisor);
+	}
+	for (int i = 0; i < 64; ++i) {
+		T const dividend = static_cast<T>(next<T>(state) >> (i % (8 * sizeof(T) - 1)));
+		REQUIRE(dividend / divider == dividend / divisor);
+		REQUIRE(dividend % divider == dividend % divisor);
+	}
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Division", "[core::Divider]", u32, u64, i32, i64) {
+	using T = TestType;
+	static_assert(100 / Divider<T>(7) == 14);
+	static_assert(quorem(T(100), Divider<T>(7)).rem == 2);
+
+	u64 state = 11;
+	for (T divisor = 1; divisor < 300; ++divisor) {
+		check<T, false>(divisor, state);
+		if (divisor != 1) {
+			check<T, true>(divisor, state);
+		}
+		if constexpr (isSigned<T>) {
+			check<T, false>(-divisor, state);
+			check<T, true>(-divisor, state);
+		}
+	}
+
+	for (int i = 0; i < 1000; ++i) {
+		auto const divisor = static_cast<T>(next<T>(state) >> (i % (8 * sizeof(T) - 1)));
+		if (divisor == 0 || divisor == 1) {
+			continue;
+		}
+		check<T, false>(divisor, state);
+		check<T, true>(divisor, state);
+	}
+
+	check<T, false>(max<T>, state);
+	check<T, true>(max<T>, state);
+	check<T, false>(static_cast<T>(max<T> / 2 + 1), state);
+	if constexpr (isSigned<T>) {
+		check<T, false>(min<T>, state);
+		check<T, true>(min<T>, state);
+	}
+}
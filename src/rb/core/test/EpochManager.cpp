@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <rb/core/memory/EpochManager.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+struct Node {
+	static inline std::atomic<int> alive{0};
+
+	int value;
+
+	explicit Node(int v)
+	    : value(v) {
+		++alive;
+	}
+
+	~Node() {
+		--alive;
+	}
+};
+
+} // namespace
+
+TEST_CASE("Pin", "[core::EpochManager]") {
+	{
+		EpochManager manager;
+		auto reader = manager.registerThread();
+		auto writer = manager.registerThread();
+		{
+			auto const guard = reader.pin();
+			REQUIRE(reader.isPinned());
+			writer.retire(new Node(1));
+			// the reader may still hold the node, so the epoch can advance at most once
+			for (int i = 0; i < 4; ++i) {
+				writer.flush();
+			}
+			REQUIRE(Node::alive == 1);
+		}
+		REQUIRE(!reader.isPinned());
+		for (int i = 0; i < 4; ++i) {
+			writer.flush();
+		}
+		REQUIRE(Node::alive == 0);
+
+		for (int i = 0; i < 3; ++i) {
+			writer.retire(new Node(i));
+		}
+	}
+	REQUIRE(Node::alive == 0);
+}
+
+TEST_CASE("Threads", "[core::EpochManager]") {
+	{
+		EpochManager manager;
+		std::atomic<Node*> shared{new Node(0)};
+		// Catch2 assertions aren't thread-safe, so the threads only count failures
+		std::atomic<int> failures{0};
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 4; ++t) {
+			threads.emplace_back([&manager, &shared, &failures, t] {
+				auto handle = manager.registerThread();
+				for (int i = 0; i < 1000; ++i) {
+					auto const guard = handle.pin();
+					if (i % 4 == 0) {
+						guard.retire(shared.exchange(new Node(t)));
+					} else if (shared.load()->value < 0) {
+						++failures;
+					}
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		REQUIRE(failures == 0);
+		delete shared.load();
+	}
+	REQUIRE(Node::alive == 0);
+}
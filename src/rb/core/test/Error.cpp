@@ -0,0 +1,48 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+
+#include <rb/core/error/OsError.hpp>
+
+using namespace rb::core;
+
+TEST_CASE("Message", "[core::Error]") {
+	static_assert(sizeof(Error) == 3 * sizeof(void*) + sizeof(SourceLocation));
+
+	constexpr char const* kStatic = "static";
+	Error const s(kStatic);
+	REQUIRE(s.message() == kStatic);
+	REQUIRE_FALSE(s.cause());
+
+	std::string text = "dynamic";
+	Error const d(text);
+	text = "changed";
+	REQUIRE(std::string(d.message()) == "dynamic");
+
+	Error const copy = d; // NOLINT(performance-unnecessary-copy-initialization)
+	REQUIRE(copy.message() == d.message());
+}
+
+TEST_CASE("Cause", "[core::Error]") {
+	Error error = Error(std::string("outer")).withCause(
+	    Error(std::string("middle")).withCause(OsError(ErrorCode::kInvalidArgument)));
+	REQUIRE(std::string(error.message()) == "outer");
+
+	Error const* middle = error.cause();
+	REQUIRE(middle);
+	REQUIRE(std::string(middle->message()) == "middle");
+	auto const* os = dynamic_cast<OsError const*>(middle->cause());
+	REQUIRE(os);
+	REQUIRE(os->errorCode() == ErrorCode::kInvalidArgument);
+	REQUIRE_FALSE(os->cause());
+
+	std::ostringstream out;
+	error.printTo(out);
+	std::string const printed = out.str();
+	REQUIRE(printed.find("\n  caused by middle") != std::string::npos);
+	REQUIRE(printed.find("\n    caused by ") != std::string::npos);
+
+	Error const copy = error;
+	REQUIRE(copy.cause() == error.cause());
+}
@@ -0,0 +1,47 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+
+#include <rb/core/memory/HazardPointer.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+struct Node {
+	static inline std::atomic<int> alive{0};
+
+	int value;
+
+	explicit Node(int v)
+	    : value(v) {
+		++alive;
+	}
+
+	~Node() {
+		--alive;
+	}
+};
+
+} // namespace
+
+TEST_CASE("Protect", "[core::HazardPointer]") {
+	{
+		HazardDomain domain;
+		std::atomic<Node*> shared{new Node(1)};
+		{
+			HazardPointer hp(domain);
+			Node* const node = hp.protect(shared);
+			domain.retire(shared.exchange(new Node(2)));
+			domain.reclaim();
+			REQUIRE(node->value == 1);
+			REQUIRE(domain.retiredCount() == 1);
+
+			hp.reset();
+			domain.reclaim();
+			REQUIRE(domain.retiredCount() == 0);
+		}
+		domain.retire(shared.load());
+	}
+	REQUIRE(Node::alive == 0);
+}
@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/containers/List.hpp>
+#include <rb/containers/Vector.hpp>
+#include <rb/core/memory/InlineArena.hpp>
+
+using namespace rb::core;
+using namespace rb::containers;
+
+TEST_CASE("Vector", "[core::InlineArena]") {
+	InlineArena<256> arena;
+	{
+		Vector<int, InlineArenaAllocator<int, 256>> v(8, 7, arena.allocator<int>());
+		REQUIRE(arena.owns(v.data()));
+		REQUIRE(v[7] == 7);
+
+		// doesn't fit anymore, so falls back to the heap
+		v.reserve(1000);
+		REQUIRE(!arena.owns(v.data()));
+		REQUIRE(v[7] == 7);
+	}
+
+	arena.reset();
+	void* const a = arena.allocate(10, 1);
+	void* const b = arena.allocate(8, 8);
+	REQUIRE(reinterpret_cast<usize>(b) % 8 == 0);
+	REQUIRE(arena.used() == 24);
+	// only the most recent block is given back, the alignment gap stays
+	arena.deallocate(a, 10, 1);
+	REQUIRE(arena.used() == 24);
+	arena.deallocate(b, 8, 8);
+	REQUIRE(arena.used() == 16);
+}
+
+TEST_CASE("Full arena", "[core::InlineArena]") {
+	InlineArena<16> arena;
+	void* const full = arena.allocate(16, 1);
+	REQUIRE(arena.owns(full));
+
+	// even an empty block is taken from the heap then, so its deallocation goes there too
+	void* const empty = arena.allocate(0, 1);
+	REQUIRE(!arena.owns(empty));
+	arena.deallocate(empty, 0, 1);
+	arena.deallocate(full, 16, 1);
+	REQUIRE(arena.used() == 0);
+}
+
+TEST_CASE("List", "[core::InlineArena]") {
+	InlineArena<1024> arena;
+	List<int, InlineArenaAllocator<int, 1024>> list({1, 2, 3}, arena.allocator<int>());
+	REQUIRE(arena.used() > 0);
+	REQUIRE(arena.owns(&list.front()));
+
+	list.insert(list.end(), 2, 4);
+	list.popFront();
+	REQUIRE(list.size() == 4);
+	REQUIRE(list.back() == 4);
+	REQUIRE(list.allocator() == arena.allocator<int>());
+}
+
+TEST_CASE("List assignment and swap", "[core::InlineArena]") {
+	InlineArena<256> arena;
+	List<int, InlineArenaAllocator<int, 256>> list(arena.allocator<int>());
+	list = {1, 2};
+	REQUIRE(list.size() == 2);
+	REQUIRE(list.back() == 2);
+	REQUIRE(arena.owns(&list.front()));
+
+	List<int, InlineArenaAllocator<int, 256>> other({3, 4, 5}, arena.allocator<int>());
+	list.swap(other);
+	REQUIRE(list.size() == 3);
+	REQUIRE(list.front() == 3);
+	REQUIRE(other.size() == 2);
+	REQUIRE(other.back() == 2);
+
+	List<int, InlineArenaAllocator<int, 256>> empty(arena.allocator<int>());
+	empty.swap(list);
+	REQUIRE(list.empty());
+	REQUIRE(empty.size() == 3);
+	REQUIRE(empty.back() == 5);
+	REQUIRE(*++empty.begin() == 4);
+	REQUIRE(*--empty.end() == 5);
+
+	auto moved = RB_MOVE(empty);
+	REQUIRE(empty.empty()); // NOLINT(bugprone-use-after-move)
+	REQUIRE(moved.size() == 3);
+	REQUIRE(*--moved.end() == 5);
+}
+
+TEST_CASE("List assignment keeps the allocator", "[core::InlineArena]") {
+	InlineArena<256> arena;
+	InlineArena<256> other;
+	List<int, InlineArenaAllocator<int, 256>> list({1, 2}, arena.allocator<int>());
+	List<int, InlineArenaAllocator<int, 256>> const source({3, 4, 5}, other.allocator<int>());
+
+	list = source;
+	REQUIRE(list == source);
+	REQUIRE(list.allocator() == arena.allocator<int>());
+	REQUIRE(arena.owns(&list.back()));
+
+	// the arenas differ, so the elements are moved into nodes of the own arena
+	List<int, InlineArenaAllocator<int, 256>> moved({6}, other.allocator<int>());
+	list = RB_MOVE(moved);
+	REQUIRE(list.size() == 1);
+	REQUIRE(list.front() == 6);
+	REQUIRE(list.allocator() == arena.allocator<int>());
+	REQUIRE(arena.owns(&list.front()));
+
+	// the same arena lets the nodes be taken over
+	List<int, InlineArenaAllocator<int, 256>> same({7, 8}, arena.allocator<int>());
+	int const* front = &same.front();
+	list = RB_MOVE(same);
+	REQUIRE(&list.front() == front);
+	REQUIRE(list.size() == 2);
+	REQUIRE(same.empty()); // NOLINT(bugprone-use-after-move)
+}
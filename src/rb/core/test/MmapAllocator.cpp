@@ -0,0 +1,83 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/containers/Vector.hpp>
+#include <rb/core/Array.hpp>
+#include <rb/core/memory/MmapAllocator.hpp>
+
+using namespace rb::core;
+using namespace rb::containers;
+
+namespace {
+
+// counts the mappings which haven't been released yet
+template <class T>
+class CountingAllocator : public MmapAllocator<T> {
+	using Super = MmapAllocator<T>;
+
+public:
+	static inline isize mapped = 0;
+
+	[[nodiscard]] T* allocate(usize n) {
+		T* const ptr = Super::allocate(n);
+		++mapped;
+		return ptr;
+	}
+
+	[[nodiscard]] T* allocateZeroed(usize n) {
+		return allocate(n);
+	}
+
+	void deallocate(T* ptr, usize n) noexcept {
+		--mapped;
+		Super::deallocate(ptr, n);
+	}
+};
+
+} // namespace
+
+TEST_CASE("Array", "[core::MmapAllocator]") {
+	MmapAllocator<u64> const alloc({MmapOption::kHugePages, MmapOption::kPopulate});
+	Array<u64, MmapAllocator<u64>> table(1 << 16, alloc);
+	REQUIRE(reinterpret_cast<usize>(table.data()) % 4096 == 0);
+	REQUIRE(table[12345] == 0);
+	table[12345] = 42;
+	REQUIRE(table[12345] == 42);
+	REQUIRE(table.allocator() == alloc);
+
+	table.allocator().release(table.data(), table.size());
+#ifdef __linux__
+	REQUIRE(table[12345] == 0);
+#endif
+}
+
+TEST_CASE("Empty Array", "[core::MmapAllocator]") {
+	// even empty blocks are whole pages, which must be unmapped
+	{
+		Array<u64, CountingAllocator<u64>> const empty(0);
+		Array<u64, CountingAllocator<u64>> const zeroed(0, rb::ext::kZeroMemory);
+		REQUIRE(empty.empty());
+		REQUIRE(CountingAllocator<u64>::mapped == 2);
+	}
+	REQUIRE(CountingAllocator<u64>::mapped == 0);
+}
+
+TEST_CASE("Huge pages", "[core::MmapAllocator]") {
+	constexpr usize kHugePage = usize{2} << 20;
+	MmapAllocator<u8> alloc({MmapOption::kHugePages, MmapOption::kPopulate});
+	u8* const block = alloc.allocate(2 * kHugePage + 1);
+#ifdef __linux__
+	REQUIRE(reinterpret_cast<usize>(block) % kHugePage == 0);
+#endif
+	REQUIRE(block[2 * kHugePage] == 0);
+	block[0] = 1;
+	block[2 * kHugePage] = 2;
+	REQUIRE(block[0] + block[2 * kHugePage] == 3);
+	alloc.deallocate(block, 2 * kHugePage + 1);
+}
+
+TEST_CASE("Vector", "[core::MmapAllocator]") {
+	Vector<int, MmapAllocator<int>> v(3, 7);
+	v.reserve(100'000);
+	REQUIRE(v.size() == 3);
+	REQUIRE(v[2] == 7);
+}
@@ -0,0 +1,37 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/core/memory/NumaAllocator.hpp>
+#include <rb/sync/Thread.hpp>
+
+using namespace rb::core;
+
+TEST_CASE("Topology", "[core::NumaAllocator]") {
+	usize const count = numaNodeCount();
+	REQUIRE(count >= 1);
+	REQUIRE(numaNodeOfCpu(0) < count);
+	REQUIRE(currentNumaNode() < count);
+	if (count == 1) {
+		REQUIRE_FALSE(bindThreadToNumaNode(0));
+	}
+}
+
+TEST_CASE("Thread", "[core::NumaAllocator]") {
+	struct Worker final : rb::sync::Thread {
+		NumaAllocator<u64> alloc{numaNodeCount() - 1};
+		u64* data = nullptr;
+
+		void run() override {
+			data = alloc.allocate(1000);
+			data[999] = 42;
+		}
+	};
+
+	Worker worker;
+	worker.setNumaNode(worker.alloc.node());
+	REQUIRE(*worker.numaNode() == worker.alloc.node());
+	worker.start();
+	worker.join();
+	REQUIRE(worker.data[0] == 0);
+	REQUIRE(worker.data[999] == 42);
+	worker.alloc.deallocate(worker.data, 1000);
+}
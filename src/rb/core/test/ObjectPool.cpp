@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <rb/core/memory/ObjectPool.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+struct Counted {
+	static inline std::atomic<int> alive{0};
+
+	int value;
+
+	explicit Counted(int v)
+	    : value(v) {
+		++alive;
+	}
+
+	~Counted() {
+		--alive;
+	}
+};
+
+} // namespace
+
+TEST_CASE("Reuse", "[core::ObjectPool]") {
+	ObjectPool<Counted> pool;
+	Counted* raw = nullptr;
+	{
+		auto const ptr = pool.make(42);
+		REQUIRE(ptr->value == 42);
+		REQUIRE(Counted::alive == 1);
+		raw = const_cast<Counted*>(ptr.get());
+	}
+	REQUIRE(Counted::alive == 0);
+	auto const ptr = pool.make(7);
+	REQUIRE(ptr.get() == raw);
+}
+
+TEST_CASE("Threads", "[core::ObjectPool]") {
+	ObjectPool<Counted, 8> pool;
+	// Catch2 assertions aren't thread-safe, so the threads only count mismatches
+	std::atomic<int> failures{0};
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&pool, &failures, t] {
+			std::vector<ObjectPool<Counted, 8>::Ptr> ptrs;
+			for (int i = 0; i < 100; ++i) {
+				ptrs.push_back(pool.make(t * 100 + i));
+			}
+			for (int i = 0; i < 100; ++i) {
+				if (ptrs[static_cast<unsigned>(i)]->value != t * 100 + i) {
+					++failures;
+				}
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	REQUIRE(failures == 0);
+	REQUIRE(Counted::alive == 0);
+}
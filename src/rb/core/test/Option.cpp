@@ -0,0 +1,130 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/core/Option.hpp>
+#include <rb/ext/NotNull.hpp>
+#include <rb/time/Duration.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+enum class Color : u8 {
+	kRed,
+	kGreen,
+	kBlue
+};
+
+} // namespace
+
+template <>
+struct rb::core::NicheTraits<Color> : EnumNicheTraits<Color, Color::kBlue> {};
+
+TEST_CASE("Niches", "[core::Option]") {
+	using rb::ext::NotNull;
+	using rb::time::Duration;
+
+	static_assert(sizeof(Option<NotNull<int*>>) == sizeof(int*));
+	static_assert(sizeof(Option<Duration>) == sizeof(Duration));
+	static_assert(sizeof(Option<Color>) == sizeof(Color));
+	static_assert(sizeof(Option<int>) > sizeof(int));
+
+	// the niches of bool aren't bool values, so Option<bool> keeps a flag and stays usable in constant expressions
+	constexpr Option<bool> none;
+	static_assert(!none.hasValue());
+	static_assert(Option<bool>{true}.hasValue());
+	static_assert(*Option<bool>{false} == false);
+	constexpr Option<Duration> noDuration;
+	static_assert(!noDuration.hasValue());
+	static_assert(Option<Duration>{Duration::inf()}.hasValue());
+	static_assert(Option<Duration>{Duration::nan()}->isNaN());
+	static_assert(!Option<NotNull<int*>>{}.hasValue());
+	static_assert(*Option<Color>{Color::kBlue} == Color::kBlue);
+
+	int x = 42;
+	Option<NotNull<int*>> ptr;
+	REQUIRE_FALSE(ptr);
+	ptr = NotNull<int*>(&x);
+	REQUIRE(ptr);
+	REQUIRE(**ptr == 42);
+	ptr.reset();
+	REQUIRE_FALSE(ptr);
+
+	Option<Duration> dur = Duration::nan();
+	REQUIRE(dur);
+	REQUIRE(dur->isNaN());
+	dur = Duration::inf();
+	REQUIRE(dur->isInf());
+	Option<Duration> const copy = dur;
+	REQUIRE(copy == dur);
+	dur = {};
+	REQUIRE_FALSE(dur);
+	REQUIRE(copy != dur);
+
+	Option<Color> color;
+	REQUIRE_FALSE(color);
+	color = Color::kBlue;
+	REQUIRE(*color == Color::kBlue);
+
+	Option<bool> flag = false;
+	REQUIRE(flag);
+	REQUIRE_FALSE(*flag);
+	flag = kNone;
+	REQUIRE_FALSE(flag);
+}
+
+TEST_CASE("References", "[core::Option]") {
+	static_assert(sizeof(Option<int&>) == sizeof(int*));
+	static_assert(isTriviallyCopyable<Option<int const&>>);
+
+	int x = 1;
+	int y = 2;
+	Option<int&> ref = x;
+	Option<int&> copy = ref;
+	REQUIRE(&*copy == &x);
+	*ref = 3;
+	REQUIRE(x == 3);
+
+	ref = y;
+	REQUIRE(&*ref == &y);
+	REQUIRE(x == 3);
+
+	Option<int const&> const cref = ref;
+	REQUIRE(*cref == 2);
+	REQUIRE(ref.map([](int v) { return v + 1; }) == Option(3));
+
+	ref.reset();
+	REQUIRE_FALSE(ref);
+	REQUIRE(ref.valueOr(5) == 5);
+}
+
+TEST_CASE("Void", "[core::Option]") {
+	static_assert(sizeof(Option<void>) == sizeof(bool));
+
+	Option<void> none;
+	REQUIRE_FALSE(none);
+	Option<void> some{kInPlace};
+	REQUIRE(some);
+	REQUIRE(some != none);
+
+	int calls = 0;
+	auto const mapped = some.map([&] {
+		++calls;
+	});
+	static_assert(isSame<decltype(mapped), Option<void> const>);
+	REQUIRE(mapped);
+	REQUIRE(some.map([] { return 1; }) == Option(1));
+	REQUIRE_FALSE(none.map([&] {
+		++calls;
+	}));
+	REQUIRE(calls == 1);
+
+	Option const value = 4;
+	Option<void> const done = value.map([&](int v) {
+		calls += v;
+	});
+	REQUIRE(done);
+	REQUIRE(calls == 5);
+
+	some = kNone;
+	REQUIRE(some == none);
+}
@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <rb/core/memory/RcPtr.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+struct Node : RefCounted<Node> {
+	static inline int alive = 0;
+
+	int value;
+
+	explicit Node(int v)
+	    : value(v) {
+		++alive;
+	}
+
+	~Node() {
+		--alive;
+	}
+};
+
+struct Local final : RefCounted<Local, NonAtomicCounting> {
+	int value = 0;
+};
+
+} // namespace
+
+static_assert(sizeof(RcPtr<Node>) == sizeof(Node*));
+
+TEST_CASE("Ownership", "[core::RcPtr]") {
+	{
+		RcPtr<Node> p = makeRc<Node>(42);
+		REQUIRE(p->value == 42);
+		REQUIRE(p.useCount() == 1);
+		{
+			RcPtr<Node> const q = p;
+			REQUIRE(p.useCount() == 2);
+			REQUIRE(q == p);
+		}
+		REQUIRE(p.useCount() == 1);
+
+		RcPtr<Node> r = RB_MOVE(p);
+		REQUIRE(p == nullptr);
+		REQUIRE(r.useCount() == 1);
+
+		// the count is intrusive, so a raw pointer can be re-wrapped safely
+		RcPtr<Node> const s(r.get());
+		REQUIRE(r.useCount() == 2);
+		r.reset();
+		REQUIRE(Node::alive == 1);
+		REQUIRE(s.useCount() == 1);
+	}
+	REQUIRE(Node::alive == 0);
+
+	RcPtr<Local> l = makeRc<Local>();
+	RcPtr<Local> const m = l;
+	REQUIRE(m.useCount() == 2);
+}
+
+TEST_CASE("Threads", "[core::RcPtr]") {
+	RcPtr<Node> p = makeRc<Node>(1);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([p] {
+			for (int i = 0; i < 10000; ++i) {
+				RcPtr<Node> const copy = p;
+				RB_UNUSED(copy);
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	REQUIRE(p.useCount() == 1);
+	p = nullptr;
+	REQUIRE(Node::alive == 0);
+}
@@ -0,0 +1,215 @@
+#include <cmath>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/core/Simd.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+u64 next(u64& state) noexcept {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+template <class T>
+T random(u64& state) noexcept {
+	if constexpr (isFloatingPoint<T>) {
+		if (next(state) % 16 == 0) {
+			return qnan<T>;
+		}
+		// quarters of small integers, so the sums are exact in any order
+		return static_cast<T>(static_cast<i64>(next(state) % 401) - 200) / 4;
+	} else if (next(state) % 4 == 0) {
+		// the extremes and the neighbours of zero are the usual suspects
+		T const special[] = {0, 1, static_cast<T>(-1), min<T>, max<T>};
+		return special[next(state) % 5];
+	} else {
+		return static_cast<T>(next(state));
+	}
+}
+
+template <class T>
+T wrap(u64 value) noexcept {
+	return static_cast<T>(value);
+}
+
+template <class T>
+bool isNaN(T value) noexcept {
+	if constexpr (isFloatingPoint<T>) {
+		return std::isnan(value);
+	} else {
+		return false;
+	}
+}
+
+// NaN lanes have to come out as NaN
+template <class T>
+bool same(T x, T y) noexcept {
+	return x == y || (isNaN(x) && isNaN(y));
+}
+
+template <class T, usize n>
+void check(u64& state) {
+	using V = Simd<T, n>;
+	T a[n];
+	T b[n];
+	T out[n];
+	for (usize i = 0; i < n; ++i) {
+		a[i] = random<T>(state);
+		b[i] = i % 3 == 0 ? a[i] : random<T>(state);
+	}
+
+	V const va = V::load(a);
+	V const vb = V::load(b);
+	REQUIRE(V{}[0] == T{});
+	REQUIRE(same(V{b[0]}[n - 1], b[0]));
+
+	auto const lanes = [&](V v) {
+		v.store(out);
+		return out;
+	};
+	auto const each = [&](V v, auto expected) {
+		T const* result = lanes(v);
+		for (usize i = 0; i < n; ++i) {
+			REQUIRE(same(result[i], static_cast<T>(expected(a[i], b[i]))));
+		}
+	};
+	auto const eachMask = [&](typename V::Mask mask, auto expected) {
+		u64 bits = 0;
+		for (usize i = 0; i < n; ++i) {
+			bits |= u64{expected(a[i], b[i])} << i;
+			REQUIRE(mask[i] == expected(a[i], b[i]));
+		}
+		REQUIRE(mask.movemask() == bits);
+		REQUIRE(mask.any() == (bits != 0));
+		REQUIRE(mask.none() == (bits == 0));
+	};
+
+	if constexpr (isFloatingPoint<T>) {
+		each(va + vb, [](T x, T y) { return x + y; });
+		each(va - vb, [](T x, T y) { return x - y; });
+		each(va * vb, [](T x, T y) { return x * y; });
+		each(va / 2, [](T x, T /*unused*/) { return x / 2; });
+		each(-va, [](T x, T /*unused*/) { return -x; });
+	} else {
+		each(va + vb, [](T x, T y) { return wrap<T>(u64(x) + u64(y)); });
+		each(va - vb, [](T x, T y) { return wrap<T>(u64(x) - u64(y)); });
+		each(va * vb, [](T x, T y) { return wrap<T>(u64(x) * u64(y)); });
+		each(va & vb, [](T x, T y) { return x & y; });
+		each(va | vb, [](T x, T y) { return x | y; });
+		each(va ^ vb, [](T x, T y) { return x ^ y; });
+		each(-va, [](T x, T /*unused*/) { return wrap<T>(0 - u64(x)); });
+		each(~va, [](T x, T /*unused*/) { return ~x; });
+	}
+	each(minimum(va, vb), [](T x, T y) { return x < y ? x : y; });
+	each(maximum(va, vb), [](T x, T y) { return y < x ? x : y; });
+	each(blend(va < vb, va, vb), [](T x, T y) { return x < y ? x : y; });
+
+	eachMask(va == vb, [](T x, T y) { return x == y; });
+	eachMask(va != vb, [](T x, T y) { return x != y; });
+	eachMask(va < vb, [](T x, T y) { return x < y; });
+	eachMask(va <= vb, [](T x, T y) { return x <= y; });
+	eachMask(va > vb, [](T x, T y) { return x > y; });
+	eachMask(va >= vb, [](T x, T y) { return x >= y; });
+	eachMask((va < vb) | (va == vb), [](T x, T y) { return x <= y; });
+	eachMask((va <= vb) & (va >= vb), [](T x, T y) { return x == y; });
+	eachMask((va <= vb) ^ (va >= vb), [](T x, T y) { return (x <= y) != (x >= y); });
+	eachMask(~(va < vb), [](T x, T y) { return !(x < y); });
+
+	bool hasNaN = false;
+	for (usize i = 0; i < n; ++i) {
+		hasNaN = hasNaN || isNaN(a[i]);
+	}
+	REQUIRE((va == va).all() == !hasNaN);
+
+	T sum = a[0];
+	T lo = a[0];
+	T hi = a[0];
+	for (usize i = 1; i < n; ++i) {
+		if constexpr (isFloatingPoint<T>) {
+			sum += a[i];
+		} else {
+			sum = wrap<T>(u64(sum) + u64(a[i]));
+		}
+		lo = a[i] < lo ? a[i] : lo;
+		hi = hi < a[i] ? a[i] : hi;
+	}
+	REQUIRE(same(va.reduceAdd(), sum));
+	if (!hasNaN) {
+		REQUIRE(va.reduceMin() == lo);
+		REQUIRE(va.reduceMax() == hi);
+	}
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Lanes", "[core::Simd]", i8, u8, i16, u16, i32, u32, i64, u64, f32, f64) {
+	using T = TestType;
+	static_assert(Simd<T>::size() == kSimdLanes<T>);
+
+	u64 state = 17;
+	for (int i = 0; i < 100; ++i) {
+		check<T, 16 / sizeof(T)>(state);
+		check<T, 32 / sizeof(T)>(state);
+		check<T, 3>(state);
+	}
+}
+
+TEMPLATE_TEST_CASE("NaN lanes", "[core::Simd]", f32, f64) {
+	using T = TestType;
+	using V = Simd<T>;
+	V const nan{qnan<T>};
+	V const one{1};
+
+	// like minps and maxps, the second argument wins
+	REQUIRE(minimum(nan, one)[0] == 1);
+	REQUIRE(maximum(nan, one)[0] == 1);
+	REQUIRE(std::isnan(minimum(one, nan)[0]));
+	REQUIRE(std::isnan(maximum(one, nan)[0]));
+
+	REQUIRE((nan == nan).none());
+	REQUIRE((nan != nan).all());
+	REQUIRE((nan < one).none());
+	REQUIRE((nan >= one).none());
+	REQUIRE(std::isnan((nan + one)[0]));
+	REQUIRE(std::isnan((one * nan)[V::size() - 1]));
+	REQUIRE(std::isnan(nan.reduceAdd()));
+}
+
+TEMPLATE_TEST_CASE("Negation", "[core::Simd]", f32, f64) {
+	using T = TestType;
+	using V = Simd<T>;
+	REQUIRE(std::signbit((-V{0})[0]));
+	REQUIRE(!std::signbit((-V{-T{0}})[V::size() - 1]));
+	REQUIRE((-V{2})[0] == -2);
+	REQUIRE(std::signbit((-V{qnan<T>})[0]));
+}
+
+TEST_CASE("Byte search", "[core::Simd]") {
+	// the typical use: find the first occurrence of a byte 16 bytes at a time
+	// the buffer is padded to a whole number of vectors
+	char const text[48] = "the quick brown fox jumps over the lazy dog";
+	auto const find = [&](char c) -> usize {
+		using V = Simd<u8, 16>;
+		auto const* bytes = reinterpret_cast<u8 const*>(text); // NOLINT(*-reinterpret-cast)
+		for (usize i = 0; i < sizeof(text); i += V::size()) {
+			u64 bits = (V::load({bytes + i, V::size()}) == V{static_cast<u8>(c)}).movemask();
+			if (bits) {
+				for (; !(bits & 1); bits >>= 1) {
+					++i;
+				}
+				return i;
+			}
+		}
+		return sizeof(text);
+	};
+	REQUIRE(find('t') == 0);
+	REQUIRE(find('x') == 18);
+	REQUIRE(find('z') == 37);
+	REQUIRE(find('!') == sizeof(text));
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <tuple>
+
+#include <rb/core/traits/IsTupleLike.hpp>
+#include <rb/core/Tuple.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+struct Tag {
+	friend bool operator==(Tag /*lhs*/, Tag /*rhs*/) noexcept {
+		return true;
+	}
+
+	friend bool operator<(Tag /*lhs*/, Tag /*rhs*/) noexcept {
+		return false;
+	}
+};
+
+struct OtherTag {};
+
+} // namespace
+
+TEST_CASE("Layout", "[core::Tuple]") {
+	static_assert(sizeof(Tuple<u8, u64, u8, u32>) == 16);
+	static_assert(sizeof(std::tuple<u8, u64, u8, u32>) > 16);
+	static_assert(sizeof(Tuple<u32, Tag>) == 4);
+	static_assert(sizeof(Tuple<Tag, u32, OtherTag>) == 4);
+	static_assert(sizeof(Tuple<Tag, OtherTag>) == 1);
+	static_assert(isTriviallyCopyable<Tuple<u8, u64, Tag>>);
+	static_assert(!isTriviallyCopyable<Tuple<int, std::string>>);
+	static_assert(isTupleLike<Tuple<int, Tag>> && isTupleLike<Tuple<>>);
+
+	Tuple<u8, u64, u8, u32> t{u8{1}, u64{2}, u8{3}, u32{4}};
+	REQUIRE(get<0>(t) == 1);
+	REQUIRE(get<1>(t) == 2);
+	REQUIRE(get<2>(t) == 3);
+	REQUIRE(get<3>(t) == 4);
+}
+
+TEST_CASE("Values", "[core::Tuple]") {
+	auto t = makeTuple(1, std::string("one"), Tag());
+	static_assert(isSame<decltype(t), Tuple<int, std::string, Tag>>);
+
+	auto& [i, s, tag] = t;
+	static_assert(isSame<decltype(tag), Tag>);
+	i = 2;
+	REQUIRE(get<0>(t) == 2);
+	REQUIRE(s == "one");
+
+	auto u = t;
+	REQUIRE(u == t);
+	get<1>(u) = "two";
+	REQUIRE(u != t);
+	REQUIRE(t < u);
+
+	swap(t, u);
+	REQUIRE(get<1>(t) == "two");
+	REQUIRE(get<1>(RB_MOVE(u)) == "one");
+
+	Tuple<long, double> const converted(1, 2.5f);
+	REQUIRE(converted == Tuple(1, 2.5));
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <rb/core/memory/UniquePtr.hpp>
+#include <rb/core/UniqueFunction.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+int twice(int x) noexcept {
+	return 2 * x;
+}
+
+struct Counter {
+	int calls = 0;
+
+	int operator()(int x) {
+		++calls;
+		return x + calls;
+	}
+};
+
+struct Big {
+	u64 data[8] = {};
+
+	u64 operator()() const noexcept {
+		return data[7];
+	}
+};
+
+} // namespace
+
+TEST_CASE("FunctionRef", "[core::UniqueFunction]") {
+	static_assert(sizeof(FunctionRef<int(int)>) == 2 * sizeof(void*));
+	static_assert(isTriviallyCopyable<FunctionRef<int(int)>>);
+	static_assert(isConstructible<FunctionRef<int(int) noexcept>, decltype(&twice)>);
+	static_assert(!isConstructible<FunctionRef<int(int) noexcept>, Counter&>);
+	static_assert(!isConstructible<FunctionRef<int(int) const>, Counter&>);
+
+	FunctionRef<int(int)> ref = twice;
+	REQUIRE(ref(21) == 42);
+
+	Counter counter;
+	ref = counter;
+	REQUIRE(ref(1) == 2);
+	REQUIRE(ref(1) == 3);
+	REQUIRE(counter.calls == 2);
+
+	int const base = 10;
+	auto add = [&](int x) noexcept {
+		return base + x;
+	};
+	FunctionRef<int(int) const noexcept> constRef = add;
+	REQUIRE(constRef(5) == 15);
+}
+
+TEST_CASE("UniqueFunction", "[core::UniqueFunction]") {
+	using Fn = UniqueFunction<int(int)>;
+	static_assert(!isCopyConstructible<Fn> && isNothrowMoveConstructible<Fn>);
+	static_assert(Fn::kStoredInline<Counter> && !Fn::kStoredInline<Big>);
+	static_assert(UniqueFunction<u64() const, sizeof(Big)>::kStoredInline<Big>);
+	static_assert(!isConstructible<UniqueFunction<int(int) noexcept>, Counter>);
+
+	Fn empty;
+	REQUIRE_FALSE(empty);
+	REQUIRE(empty == nullptr);
+	REQUIRE(Fn(static_cast<int (*)(int)>(nullptr)) == nullptr);
+
+	Fn fn = Counter{};
+	REQUIRE(fn(1) == 2);
+	Fn moved = RB_MOVE(fn);
+	REQUIRE_FALSE(fn);
+	REQUIRE(moved(1) == 3);
+
+	fn = twice;
+	swap(fn, moved);
+	REQUIRE(fn(1) == 4);
+	REQUIRE(moved(4) == 8);
+
+	// move-only captures
+	auto ptr = UniquePtr<int>::from(5);
+	UniqueFunction<int() const noexcept> owner = [p = RB_MOVE(ptr)]() noexcept {
+		return *p;
+	};
+	REQUIRE(owner() == 5);
+	auto other = RB_MOVE(owner);
+	REQUIRE(other() == 5);
+	other = nullptr;
+	REQUIRE_FALSE(other);
+
+	Big big;
+	big.data[7] = 7;
+	UniqueFunction<u64() const> heap(kInPlaceType<Big>, big);
+	UniqueFunction<u64() const> heapMoved = RB_MOVE(heap);
+	REQUIRE(heapMoved() == 7);
+}
@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+
+#include <rb/core/Variant.hpp>
+
+using namespace rb::core;
+
+TEST_CASE("Layout", "[core::Variant]") {
+	static_assert(sizeof(Variant<u32, float>) == 8);
+	static_assert(sizeof(Variant<u8, i8>) == 2);
+	static_assert(sizeof(Variant<bool, Monostate>) == 1);
+	static_assert(isTriviallyCopyable<Variant<int, double>>);
+	static_assert(isTriviallyDestructible<Variant<int, double>>);
+	static_assert(!isTriviallyCopyable<Variant<int, std::string>>);
+
+	Variant<bool, Monostate> b;
+	REQUIRE(b.index() == 0);
+	REQUIRE_FALSE(b.get<bool>());
+	b = Monostate();
+	REQUIRE(b.holds<Monostate>());
+	b = true;
+	REQUIRE(b.get<0>());
+}
+
+TEST_CASE("Values", "[core::Variant]") {
+	Variant<int, std::string> v("a string long enough to defeat the short string optimization");
+	REQUIRE(v.index() == 1);
+	auto w = v;
+	REQUIRE(w == v);
+	w = 42;
+	REQUIRE(w.get<int>() == 42);
+	REQUIRE(w != v);
+	REQUIRE(w < v);
+	REQUIRE(v.getIf<int>() == nullptr);
+
+	w.swap(v);
+	REQUIRE(v.get<0>() == 42);
+	REQUIRE(w.holds<std::string>());
+
+	std::ostringstream os;
+	os << v;
+	REQUIRE(os.str() == "42");
+
+	v.emplace<std::string>(3, 'x');
+	REQUIRE(v.get<1>() == "xxx");
+}
+
+TEST_CASE("Visit", "[core::Variant]") {
+	Variant<int, double, std::string> const a = 2.5;
+	Variant<int, std::string> const b = std::string("b");
+
+	auto const name = [](auto const& value) {
+		using T = RemoveCvRef<decltype(value)>;
+		return isSame<T, int> ? 'i' : isSame<T, double> ? 'd' : 's';
+	};
+	REQUIRE(visit(name, a) == 'd');
+	REQUIRE(visit([&](auto const& x, auto const& y) { return std::string{name(x), name(y)}; }, a, b) == "ds");
+
+	Variant<int, double> c = 1;
+	visit([](auto& x) { x *= 3; }, c);
+	REQUIRE(c.get<int>() == 3);
+}
@@ -0,0 +1,128 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include <rb/core/bits.hpp>
+#include <rb/core/byteOrder.hpp>
+#include <rb/core/CpuFeatures.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+template <class T>
+void checkRoundTrip(usize count) {
+	std::vector<T> values(count);
+	for (usize i = 0; i < count; ++i) {
+		values[i] = static_cast<T>(0x0102'0304'0506'0708ULL * (i + 1));
+	}
+
+	std::vector<byte> bytes(count * sizeof(T));
+	storeBigEndian(Span{values}, Span{bytes});
+	for (usize i = 0; i < count; ++i) {
+		for (usize j = 0; j < sizeof(T); ++j) {
+			auto const shift = 8 * (sizeof(T) - 1 - j);
+			REQUIRE(toInt<u64>(bytes[i * sizeof(T) + j]) == ((static_cast<u64>(values[i]) >> shift) & 0xff));
+		}
+	}
+
+	std::vector<T> decoded(count);
+	loadBigEndian(Span{bytes}, Span{decoded});
+	REQUIRE(decoded == values);
+
+	storeLittleEndian(Span{values}, Span{bytes});
+	loadLittleEndian(Span{bytes}, Span{decoded});
+	REQUIRE(decoded == values);
+
+	bswapInPlace(Span{decoded});
+	for (usize i = 0; i < count; ++i) {
+		REQUIRE(decoded[i] == bswap(values[i]));
+	}
+}
+
+using Kernel = void (*)(void const* src, void* dst, usize count, usize size) noexcept;
+
+// compares @p kernel with the scalar one, out of place and in place
+void checkKernel(Kernel kernel) {
+	for (usize size : {2, 4, 8}) {
+		// the counts cover the 32- and 16-byte loops and every length of the scalar tail after them
+		for (usize count = 0; count <= 40; ++count) {
+			std::vector<byte> src(count * size);
+			for (usize i = 0; i < src.size(); ++i) {
+				src[i] = static_cast<byte>(i * 7 + 1);
+			}
+
+			std::vector<byte> expected(src.size());
+			impl::byteOrder::bswapScalar(src.data(), expected.data(), count, size);
+			std::vector<byte> actual(src.size());
+			kernel(src.data(), actual.data(), count, size);
+			REQUIRE(actual == expected);
+
+			kernel(src.data(), src.data(), count, size);
+			REQUIRE(src == expected);
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("Kernels", "[core::byteOrder]") {
+	std::vector<byte> bytes{1_b, 2_b, 3_b, 4_b};
+	impl::byteOrder::bswapScalar(bytes.data(), bytes.data(), 1, 4);
+	REQUIRE(bytes == std::vector<byte>{4_b, 3_b, 2_b, 1_b});
+
+	checkKernel(impl::byteOrder::bswapCopy);
+#if RB_BYTE_ORDER_X86
+	checkKernel(impl::byteOrder::bswapSse2);
+	if (hasCpuFeatures(CpuFeature::kSsse3)) {
+		checkKernel(impl::byteOrder::bswapSsse3);
+	}
+	if (hasCpuFeatures(CpuFeature::kAvx2)) {
+		checkKernel(impl::byteOrder::bswapAvx2);
+	}
+#elif RB_BYTE_ORDER_NEON
+	checkKernel(impl::byteOrder::bswapNeon);
+#endif
+}
+
+TEST_CASE("Span conversions", "[core::byteOrder]") {
+	// the odd sizes cover the scalar tail after the vector loops
+	for (usize count : {0, 1, 3, 7, 8, 17, 33, 100}) {
+		checkRoundTrip<u8>(count);
+		checkRoundTrip<u16>(count);
+		checkRoundTrip<i32>(count);
+		checkRoundTrip<u64>(count);
+	}
+
+	f64 values[] = {1.5, -0.25, 3.0};
+	byte bytes[sizeof(values)];
+	storeBigEndian(Span{values}, Span{bytes});
+	REQUIRE(bytes[0] == 0x3f_b);
+	REQUIRE(bytes[1] == 0xf8_b);
+	f64 decoded[3];
+	loadBigEndian(Span{bytes}, Span{decoded});
+	REQUIRE(decoded[2] == 3.0);
+}
+
+TEST_CASE("Span conversions benchmark", "[.][benchmark][core::byteOrder]") {
+	std::vector<u32> values(4096);
+	std::vector<byte> bytes(values.size() * sizeof(u32));
+	for (usize i = 0; i < bytes.size(); ++i) {
+		bytes[i] = static_cast<byte>(i * 7);
+	}
+
+	BENCHMARK("loadBigEndian") {
+		loadBigEndian(Span{bytes}, Span{values});
+		return values.back();
+	};
+
+	BENCHMARK("bswap per element") {
+		for (usize i = 0; i < values.size(); ++i) {
+			u32 value;
+			std::memcpy(&value, bytes.data() + i * sizeof(u32), sizeof(u32));
+			values[i] = fromBigEndian(value);
+		}
+		return values.back();
+	};
+}
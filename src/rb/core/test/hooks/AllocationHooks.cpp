@@ -0,0 +1,44 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <string>
+
+#include <rb/core/memory/AllocationTracker.hpp>
+
+using namespace rb::core;
+
+// these tests run in their own executable, since the hooks replace global operator new for the whole program
+
+TEST_CASE("Global operator new", "[core::AllocationHooks]") {
+	REQUIRE(allocationsDuring([] {
+		delete new int(0);
+	}) == 1);
+	REQUIRE(allocationsDuring([] {
+		auto const str = std::make_unique<std::string>(100, 'x');
+	}) == 2);
+}
+
+TEST_CASE("Live bytes", "[core::AllocationHooks]") {
+	auto& tracker = AllocationTracker::global();
+	usize const before = tracker.snapshot().liveBytes;
+	auto* const ptr = new char[1000];
+	usize const during = tracker.snapshot().liveBytes;
+	delete[] ptr;
+	REQUIRE(during - before == 1000);
+	REQUIRE(tracker.snapshot().liveBytes == before);
+}
+
+TEST_CASE("Scope", "[core::AllocationHooks]") {
+	auto& tracker = AllocationTracker::global();
+	tracker.reset();
+	unsigned line = 0;
+	{
+		line = __LINE__ + 1;
+		AllocationTracker::Scope const scope;
+		delete new long(0);
+	}
+	auto const snapshot = tracker.snapshot();
+	REQUIRE(snapshot.callSiteCount == 1);
+	REQUIRE(snapshot.callSites[0].location.line() == line);
+	REQUIRE(snapshot.callSites[0].bytes == sizeof(long));
+}
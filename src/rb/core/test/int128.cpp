@@ -0,0 +1,192 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <string_view>
+
+#include <rb/core/int128.hpp>
+#include <rb/fmt/charconv.hpp>
+
+using namespace rb::core;
+
+namespace {
+
+// xorshift64, so the values are the same on every run
+u64 next(u64& state) noexcept {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+constexpr u128 make(u64 hi, u64 lo) noexcept {
+	return (u128{hi} << 64) | lo;
+}
+
+// the shift-subtract division which was used before the hardware paths, kept as a reference
+void divModBitwise(u128 dividend, u128 divisor, u128& quo, u128& rem) noexcept {
+	if (divisor > dividend) {
+		quo = 0;
+		rem = dividend;
+		return;
+	}
+
+	u128 denominator = divisor;
+	u128 quotient;
+	unsigned const shift = fls128(dividend) - fls128(denominator);
+	denominator <<= static_cast<int>(shift);
+	for (unsigned i = 0; i <= shift; ++i) {
+		quotient <<= 1;
+		if (dividend >= denominator) {
+			dividend -= denominator;
+			quotient |= 1;
+		}
+		denominator >>= 1;
+	}
+
+	quo = quotient;
+	rem = dividend;
+}
+
+} // namespace
+
+TEST_CASE("Multiplication", "[core::int128]") {
+	static_assert(u128::max() * u128::max() == 1);
+	static_assert(make(1, 0) * make(1, 0) == 0);
+	static_assert(u128{~0ULL} * u128{~0ULL} == make(~0ULL - 1, 1));
+	static_assert(-3_i128 * 5 == -15);
+
+	u64 lo = 0;
+	u64 hi = 0;
+	u64 state = 42;
+	for (int i = 0; i < 1000; ++i) {
+		u64 const a = next(state);
+		u64 const b = next(state) >> (i % 64);
+		lo = impl::int128::mulWide(a, b, hi);
+		u128 const product = u128{a} * u128{b};
+		REQUIRE(make(hi, lo) == product);
+		REQUIRE(product / a == b);
+	}
+}
+
+TEST_CASE("Division", "[core::int128]") {
+	static_assert(make(1, 0) / 3 == u128{0x5555'5555'5555'5555});
+	static_assert(u128::max() % 10 == 5);
+	static_assert(-7_i128 / 2 == -3 && -7_i128 % 2 == -1);
+
+	u64 rem = 0;
+	REQUIRE(impl::int128::divWideKnuth(0, 7, 2, rem) == 3);
+	REQUIRE(rem == 1);
+	REQUIRE(impl::int128::divWideKnuth(~0ULL - 1, ~0ULL, ~0ULL, rem) == ~0ULL);
+	REQUIRE(rem == ~0ULL - 1);
+
+	u64 state = 7;
+	for (int i = 0; i < 1000; ++i) {
+		u128 const dividend = make(next(state) >> (i % 64), next(state));
+		u128 const divisor = i % 2 ? make(next(state) >> (64 - i % 64) % 64, next(state)) : u128{(next(state) >> (i % 64)) | 1};
+
+		u128 quo;
+		u128 rem128;
+		divModBitwise(dividend, divisor, quo, rem128);
+		REQUIRE(dividend / divisor == quo);
+		REQUIRE(dividend % divisor == rem128);
+
+		if (!(divisor >> 64) && static_cast<u64>(dividend >> 64) < static_cast<u64>(divisor)) {
+			u64 const q = impl::int128::divWideKnuth(
+			    static_cast<u64>(dividend >> 64), static_cast<u64>(dividend), static_cast<u64>(divisor), rem);
+			REQUIRE(u128{q} == quo);
+			REQUIRE(u128{rem} == rem128);
+		}
+	}
+}
+
+TEST_CASE("Division benchmark", "[.][benchmark][core::int128]") {
+	u64 state = 1;
+	u128 values[64];
+	for (auto& value : values) {
+		value = make(next(state) >> 4, next(state));
+	}
+	u128 const divisor64 = 1'000'000'000 * u128{4'294'967'296};
+	u128 const divisor128 = make(3, next(state));
+
+	BENCHMARK("operator/ by 64-bit") {
+		u128 sum;
+		for (auto const value : values) {
+			sum += value / divisor64;
+		}
+		return sum;
+	};
+
+	BENCHMARK("bitwise / by 64-bit") {
+		u128 sum;
+		for (auto const value : values) {
+			u128 quo;
+			u128 rem;
+			divModBitwise(value, divisor64, quo, rem);
+			sum += quo;
+		}
+		return sum;
+	};
+
+	BENCHMARK("operator% by 128-bit") {
+		u128 sum;
+		for (auto const value : values) {
+			sum += value % divisor128;
+		}
+		return sum;
+	};
+
+	BENCHMARK("bitwise % by 128-bit") {
+		u128 sum;
+		for (auto const value : values) {
+			u128 quo;
+			u128 rem;
+			divModBitwise(value, divisor128, quo, rem);
+			sum += rem;
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("String conversion", "[core::int128]") {
+	using namespace rb::fmt;
+
+	char buf[64];
+	auto const str = [&](auto value) {
+		auto const end = toChars(buf, buf + sizeof(buf), value);
+		REQUIRE(end);
+		return std::string(buf, *end);
+	};
+
+	REQUIRE(str(0_u128) == "0");
+	REQUIRE(str(u128{10'000'000'000'000'000'000ULL}) == "10000000000000000000");
+	REQUIRE(str(u128::max()) == "340282366920938463463374607431768211455");
+	REQUIRE(str(i128::min()) == "-170141183460469231731687303715884105728");
+	REQUIRE(str(-i128{make(1, 0)}) == "-18446744073709551616");
+	REQUIRE_FALSE(toChars(buf, buf + 38, u128::max()));
+	REQUIRE(*toChars<16>(buf, buf + sizeof(buf), make(0xabc, 1)) - buf == 19);
+	REQUIRE(std::string(buf, 19) == "abc0000000000000001");
+
+	auto const parse = [](std::string_view s) {
+		return fromChars<i128>(s.data(), s.data() + s.size());
+	};
+	REQUIRE(*parse("-170141183460469231731687303715884105728") == i128::min());
+	REQUIRE(*parse("170141183460469231731687303715884105727") == i128::max());
+	REQUIRE(parse("170141183460469231731687303715884105728").error() == FromCharsError::kPosOverflow);
+	REQUIRE(parse("-170141183460469231731687303715884105729").error() == FromCharsError::kNegOverflow);
+	REQUIRE(parse("-").error() == FromCharsError::kFormatError);
+
+	std::string_view const s = "340282366920938463463374607431768211456 ";
+	char const* ptr = nullptr;
+	REQUIRE(fromChars<u128>(s.data(), s.data() + s.size(), &ptr).error() == FromCharsError::kPosOverflow);
+	REQUIRE(ptr == s.data() + 39);
+	REQUIRE(*fromChars<u128>(s.data(), s.data() + 38, &ptr) == u128::max() / 10);
+	REQUIRE(ptr == s.data() + 38);
+
+	u64 state = 5;
+	for (int i = 0; i < 1000; ++i) {
+		auto const value = i128{make(next(state), next(state)) >> (i % 128)};
+		REQUIRE(*parse(str(value)) == value);
+		REQUIRE(*parse(str(-value)) == -value);
+	}
+}
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstring>
 #include <initializer_list>
 
 #include <rb/core/assert.hpp>
 #include <rb/core/InPlace.hpp>
+#include <rb/core/NicheTraits.hpp>
+#include <rb/core/traits/builtins.hpp>
 #include <rb/core/traits/assignable.hpp>
 #include <rb/core/traits/constructible.hpp>
 #include <rb/core/traits/destructible.hpp>
@@ -230,7 +233,44 @@ public:
 	// NOLINTEND(google-explicit-constructor)
 
 private:
+	template <class, class>
+	friend struct core::NicheTraits;
+
+	struct Null {};
+
+	// the niche of Option<NotNull<T>>
+	constexpr explicit NotNull(Null /*unused*/) noexcept
+	    : value_(N::null()) {
+	}
+
 	T value_;
 };
 
 } // namespace rb::ext
+
+/// The null value is never held by NotNull, so `Option<NotNull<T>>` is as large as `T`.
+template <class T>
+struct rb::core::NicheTraits<rb::ext::NotNull<T>, rb::core::EnableIf<rb::core::isTriviallyCopyable<T>>> {
+	static constexpr usize kCount = 1;
+
+	using NotNull = ext::NotNull<T>;
+
+	static constexpr NotNull make(usize /*niche*/) noexcept {
+		return NotNull(typename NotNull::Null{});
+	}
+
+	static constexpr usize index(NotNull const& value) noexcept {
+		return ext::Nullable<T>::isNull(value.value_) ? 0 : kCount;
+	}
+
+	static void store(void* storage, usize niche) noexcept {
+		NotNull const null = make(niche);
+		std::memcpy(storage, &null, sizeof(T));
+	}
+
+	static usize load(void const* storage) noexcept {
+		T value;
+		std::memcpy(&value, storage, sizeof(T));
+		return ext::Nullable<T>::isNull(value) ? 0 : kCount;
+	}
+};
@@ -1,9 +1,100 @@
 #include "ZeroMemory.hpp"
 
+#include <cstdlib>
 #include <cstring>
 
+#include <rb/core/assert.hpp>
+#include <rb/core/memory/AllocationTracker.hpp>
+#include <rb/core/memory/MmapAllocator.hpp>
+#include <rb/core/os.hpp>
 #include <rb/core/warnings.hpp>
 
+#ifdef RB_OS_WIN
+	#include <malloc.h>
+#endif
+
+using namespace rb::core;
+
+namespace {
+
+// the smallest page size of supported platforms; mappings are at least that aligned
+constexpr usize kMinPageSize = 4096;
+
+enum class ZeroedKind {
+	kMapped,
+	kCalloc,
+	kAligned,
+};
+
+// both allocation and deallocation must pick the same path
+ZeroedKind zeroedKindOf(usize bytes, usize align) noexcept {
+	if (bytes >= rb::ext::kZeroedMmapThreshold && align <= kMinPageSize) {
+		return ZeroedKind::kMapped;
+	}
+	return align <= alignof(std::max_align_t) ? ZeroedKind::kCalloc : ZeroedKind::kAligned;
+}
+
+} // namespace
+
+void* rb::ext::allocateZeroed(usize bytes, usize align) {
+	RB_ASSERT_MSG("alignment must be a power of 2", align != 0 && (align & (align - 1)) == 0);
+
+	void* ptr = nullptr;
+	switch (zeroedKindOf(bytes, align)) {
+		case ZeroedKind::kMapped:
+			// OS mappings bypass global `operator new`, so report them to the tracker explicitly
+			ptr = impl::mmapAllocate(bytes, {});
+			AllocationTracker::global().recordAllocation(bytes);
+			return ptr;
+		case ZeroedKind::kCalloc:
+			ptr = std::calloc(1, bytes == 0 ? 1 : bytes);
+			break;
+		case ZeroedKind::kAligned: {
+			if (bytes > static_cast<usize>(-1) - align) {
+				throw std::bad_alloc();
+			}
+			usize const total = bytes == 0 ? align : (bytes + align - 1) / align * align;
+#ifdef RB_OS_WIN
+			ptr = _aligned_malloc(total, align);
+#else
+			ptr = std::aligned_alloc(align, total);
+#endif
+			if (ptr) {
+				std::memset(ptr, 0, total);
+			}
+			break;
+		}
+	}
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	AllocationTracker::global().recordAllocation(bytes);
+	return ptr;
+}
+
+void rb::ext::deallocateZeroed(void* ptr, usize bytes, usize align) noexcept {
+	if (!ptr) {
+		return;
+	}
+
+	AllocationTracker::global().recordDeallocation(bytes);
+	switch (zeroedKindOf(bytes, align)) {
+		case ZeroedKind::kMapped:
+			impl::mmapDeallocate(ptr, bytes, {});
+			break;
+		case ZeroedKind::kCalloc:
+			std::free(ptr);
+			break;
+		case ZeroedKind::kAligned:
+#ifdef RB_OS_WIN
+			_aligned_free(ptr);
+#else
+			std::free(ptr);
+#endif
+			break;
+	}
+}
+
 RB_WARNING_PUSH
 RB_WARNING_POSSIBLE_NULL_ARGUMENT
 
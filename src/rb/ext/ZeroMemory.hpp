@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <new>
 
 #include <rb/core/attributes.hpp>
+#include <rb/core/export.hpp>
+#include <rb/core/helpers.hpp>
+#include <rb/core/memory/AllocationResult.hpp>
 
 namespace rb::ext {
 
@@ -10,8 +14,78 @@ struct ZeroMemory {};
 
 inline constexpr ZeroMemory kZeroMemory;
 
+/// Blocks of at least this size are mapped directly from the OS by allocateZeroed(),
+/// since fresh pages are zero-filled by the kernel and are only touched on first access.
+inline constexpr usize kZeroedMmapThreshold = usize{1} << 20;
+
+/**
+ * Allocates @p bytes of zero-filled memory aligned to @p align, avoiding writes whenever the memory is known to be zero:
+ * large blocks are fresh OS mappings, other blocks come from `calloc`, which skips clearing of fresh heap pages;
+ * only over-aligned small blocks are cleared explicitly.
+ * The memory must be released with deallocateZeroed() called with the same @p bytes and @p align.
+ * @throw std::bad_alloc if the allocation fails
+ */
+[[nodiscard]] RB_EXPORT RB_ALLOCATOR RB_RETURNS_NONNULL void* allocateZeroed(
+    usize bytes,
+    usize align = alignof(std::max_align_t));
+
+RB_EXPORT void deallocateZeroed(void* ptr, usize bytes, usize align = alignof(std::max_align_t)) noexcept;
+
+/// ZeroedAllocator hands out zero-filled memory obtained from allocateZeroed().
+template <class T>
+struct ZeroedAllocator {
+	using Value = T;
+	using Size = usize;
+	using Difference = isize;
+
+	constexpr ZeroedAllocator() noexcept = default;
+	constexpr ZeroedAllocator(ZeroedAllocator const&) noexcept = default;
+
+	// ReSharper disable once CppNonExplicitConvertingConstructor
+	template <class U>
+	constexpr ZeroedAllocator(ZeroedAllocator<U> const& /*rhs*/) noexcept { // NOLINT(google-explicit-constructor)
+	}
+
+	constexpr ZeroedAllocator& operator=(ZeroedAllocator const&) noexcept = default;
+
+	[[nodiscard]] RB_ALLOCATOR RB_RETURNS_NONNULL T* allocate(Size n) {
+		RB_CHECK_COMPLETENESS(T);
+		if (n > static_cast<Size>(-1) / sizeof(T)) {
+			throw std::bad_array_new_length();
+		}
+		return static_cast<T*>(ext::allocateZeroed(n * sizeof(T), alignof(T)));
+	}
+
+	[[nodiscard]] core::AllocationResult<T*> allocateAtLeast(Size n) {
+		return {allocate(n), n};
+	}
+
+	/// Memory is always zero-filled, see core::AllocatorTraits::allocateZeroed().
+	[[nodiscard]] T* allocateZeroed(Size n) {
+		return allocate(n);
+	}
+
+	void deallocate(T* ptr, Size n) noexcept {
+		ext::deallocateZeroed(ptr, n * sizeof(T), alignof(T));
+	}
+};
+
+template <class T, class U>
+constexpr bool operator==(ZeroedAllocator<T> const& /*lhs*/, ZeroedAllocator<U> const& /*rhs*/) noexcept {
+	return true;
+}
+
+template <class T, class U>
+constexpr bool operator!=(ZeroedAllocator<T> const& /*lhs*/, ZeroedAllocator<U> const& /*rhs*/) noexcept {
+	return false;
+}
+
 } // namespace rb::ext
 
+// These overloads must be compatible with the plain `operator delete`,
+// so they allocate through `operator new` and clear the block explicitly;
+// use rb::ext::allocateZeroed() or rb::ext::ZeroedAllocator to avoid touching large blocks.
+
 // the position of attrs is important because MSVC recognizes only attributes which placed before function
 
 [[nodiscard]] RB_ALLOCATOR RB_RETURNS_NONNULL void* operator new(
@@ -0,0 +1,33 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+#include <rb/containers/Vector.hpp>
+#include <rb/core/Array.hpp>
+#include <rb/core/memory/MmapAllocator.hpp>
+#include <rb/ext/ZeroMemory.hpp>
+
+using namespace rb::core;
+using namespace rb::containers;
+using namespace rb::ext;
+
+TEST_CASE("ZeroMemory", "[ext::ZeroMemory]") {
+	Array<u64, MmapAllocator<u64>> mapped(1 << 16, kZeroMemory);
+	REQUIRE(mapped[12345] == 0);
+
+	Array<u32> heap(100, kZeroMemory);
+	REQUIRE(std::all_of(heap.begin(), heap.end(), [](u32 x) { return x == 0; }));
+
+	// large enough to be mapped
+	Vector<u8, ZeroedAllocator<u8>> large(kZeroedMmapThreshold, kZeroMemory);
+	REQUIRE(large[large.size() - 1] == 0);
+
+	// over-aligned, so cleared explicitly
+	struct alignas(64) Line {
+		u8 bytes[64];
+	};
+
+	Vector<Line, ZeroedAllocator<Line>> lines(3, kZeroMemory);
+	REQUIRE(reinterpret_cast<usize>(lines.data()) % 64 == 0);
+	REQUIRE(lines[2].bytes[63] == 0);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <rb/core/Expected.hpp>
+#include <rb/core/int128.hpp>
 #include <rb/core/limits.hpp>
 #include <rb/core/sanitizers.hpp>
 #include <rb/core/traits/IsSigned.hpp>
@@ -23,6 +24,34 @@ namespace impl {
 			value /= kBase;
 		}
 	}
+
+	/// The number of digits in @p base of the largest power of @p base which fits into u64.
+	template <unsigned base>
+	constexpr unsigned chunkDigits() noexcept {
+		unsigned n = 0;
+		for (u64 p = 1; p <= core::max<u64> / base; p *= base) {
+			++n;
+		}
+		return n;
+	}
+
+	template <unsigned base>
+	constexpr u64 power(unsigned n) noexcept {
+		u64 p = 1;
+		while (n--) {
+			p *= base;
+		}
+		return p;
+	}
+
+	/// Writes exactly @p nbDigits digits of @p value, padded with zeroes, which end before @p end.
+	template <unsigned base, class Char>
+	constexpr void toCharsPadded(Char* end, u64 value, unsigned nbDigits) noexcept {
+		for (; nbDigits; --nbDigits) {
+			*--end = kDigits[value % base];
+			value /= base;
+		}
+	}
 } // namespace impl
 
 enum class ToCharsError {
@@ -119,6 +148,56 @@ constexpr ToCharsResult<Char> toChars(Char* first, Char* last, T value) noexcept
 	return end;
 }
 
+/// Converts @p value like the overload for built-in integers.
+/// The value is split into chunks of u64 (19 digits in base 10), so all but two divisions are 64-bit.
+template <unsigned base = 10, bool kUnsigned, class Char,
+    RB_REQUIRES(2 <= base && base <= 36)>
+constexpr ToCharsResult<Char> toChars(Char* first, Char* last, core::Int128<kUnsigned> value) noexcept
+#ifdef RB_COMPILER_CLANG
+    RB_NO_SANITIZE("address")
+#endif
+{
+	constexpr unsigned kChunkDigits = impl::chunkDigits<base>();
+	constexpr u64 kChunk = impl::power<base>(kChunkDigits);
+
+	if (!first || last <= first) {
+		return core::err(ToCharsError::kInvalidRange);
+	}
+
+	bool isNeg = false;
+	if constexpr (!kUnsigned) {
+		isNeg = value < 0;
+	}
+
+	// at most two chunks are needed for any base, since kChunk >= 2^58
+	core::u128 magnitude = core::abs(value);
+	u64 chunks[2] = {};
+	unsigned nbChunks = 0;
+	while (magnitude >= kChunk) {
+		auto const [quo, rem] = core::quorem(magnitude, core::u128{kChunk});
+		chunks[nbChunks++] = static_cast<u64>(rem);
+		magnitude = quo;
+	}
+
+	auto const head = static_cast<u64>(magnitude);
+	auto const nbHeadChars = countChars<base>(head);
+	auto* const end = first + (isNeg ? 1 : 0) + nbHeadChars + nbChunks * kChunkDigits;
+	if (last < end) {
+		return core::err(ToCharsError::kValueTooLarge);
+	}
+
+	if (isNeg) {
+		*first++ = '-';
+	}
+	impl::toCharsPadded<base>(first + nbHeadChars, head, nbHeadChars);
+	first += nbHeadChars;
+	while (nbChunks) {
+		first += kChunkDigits;
+		impl::toCharsPadded<base>(first, chunks[--nbChunks], kChunkDigits);
+	}
+	return end;
+}
+
 enum class FromCharsError {
 	kOk,
 	kEmptyRange,
@@ -246,4 +325,100 @@ template <class T, unsigned base = 10, class Char,
 #undef RB_SET_PTR
 }
 
+/// Parses an Int128 like fromChars for built-in integers.
+/// Digits are accumulated in u64 chunks (19 digits in base 10), so there is one 128-bit step per chunk.
+template <class T, unsigned base = 10, class Char,
+    RB_REQUIRES(core::isSame<T, core::i128> || core::isSame<T, core::u128>)>
+[[nodiscard]] constexpr FromCharsResult<T> fromChars(Char const* first, Char const* last,
+    Char const** ptr = nullptr) noexcept
+#ifdef RB_COMPILER_CLANG
+    RB_NO_SANITIZE("address")
+#endif
+{
+	using core::err;
+	using core::u128;
+
+	constexpr bool kSigned = core::isSame<T, core::i128>;
+	constexpr unsigned kChunkDigits = impl::chunkDigits<base>();
+
+	auto const setPtr = [&] {
+		if (ptr) {
+			*ptr = first;
+		}
+	};
+
+	setPtr();
+
+	if (!first || last < first) {
+		return err(FromCharsError::kInvalidRange);
+	}
+
+	if (first == last) {
+		return err(FromCharsError::kEmptyRange);
+	}
+
+	bool const isNeg = kSigned && *first == '-';
+	if (isNeg && first + 1 == last) {
+		return err(FromCharsError::kFormatError);
+	}
+
+	if (isNeg) {
+		++first;
+	}
+
+	if (!isDigit<base>(*first)) {
+		setPtr();
+		return err(FromCharsError::kFormatError);
+	}
+
+	// the magnitude of min<i128> is representable in u128
+	u128 const limit = kSigned ? u128{core::max<core::i128>} + (isNeg ? 1 : 0) : core::max<u128>;
+	auto const overflow = isNeg ? FromCharsError::kNegOverflow : FromCharsError::kPosOverflow;
+
+	u128 magnitude;
+	while (first < last) {
+		Char const* const chunkFirst = first;
+		u64 chunk = 0;
+		unsigned nbDigits = 0;
+		for (; first < last && nbDigits < kChunkDigits; ++first, ++nbDigits) {
+			auto const digit = isDigit<base>(*first);
+			if (!digit) {
+				break;
+			}
+			chunk = chunk * base + static_cast<u64>(*digit);
+		}
+
+		if (!nbDigits) {
+			break;
+		}
+
+		u64 const scale = impl::power<base>(nbDigits);
+		if (magnitude > (limit - chunk) / scale) {
+			// find the digit which overflows, as the overload for built-in integers does
+			for (first = chunkFirst;; ++first) {
+				auto const d = static_cast<u64>(*isDigit<base>(*first));
+				if (magnitude > (limit - d) / base) {
+					++first;
+					setPtr();
+					return err(overflow);
+				}
+				magnitude = magnitude * base + d;
+			}
+		}
+
+		magnitude = magnitude * scale + chunk;
+		if (nbDigits < kChunkDigits) {
+			break;
+		}
+	}
+
+	setPtr();
+	if constexpr (kSigned) {
+		// negate the magnitude as unsigned, since -min<i128> overflows
+		return core::i128{isNeg ? -magnitude : magnitude};
+	} else {
+		return magnitude;
+	}
+}
+
 } // namespace rb::fmt
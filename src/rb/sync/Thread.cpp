@@ -3,6 +3,7 @@
 // ReSharper disable once CppUnusedIncludeDirective
 #include <cstring>
 
+#include <rb/core/memory/NumaAllocator.hpp>
 #include <rb/core/warnings.hpp>
 #include <rb/sync/impl.hpp>
 
@@ -39,6 +40,9 @@ struct AttributeGuard {
 void* threadFunc(void* arg) noexcept {
 	auto* thread = static_cast<Thread*>(arg);
 	thisThread = thread;
+	if (auto const node = thread->numaNode()) {
+		bindThreadToNumaNode(*node);
+	}
 	thread->run();
 	return nullptr;
 }
@@ -168,6 +172,9 @@ namespace {
 unsigned WINAPI threadFunc(void* arg) noexcept {
 	auto* thread = static_cast<Thread*>(arg);
 	thisThread = thread;
+	if (auto const node = thread->numaNode()) {
+		bindThreadToNumaNode(*node);
+	}
 	thread->run();
 	return 0;
 }
@@ -267,6 +274,15 @@ Thread::~Thread() noexcept(false) {
 
 void Thread::swap(Thread& rhs) noexcept {
 	pImpl_.swap(rhs.pImpl_);
+	numaNode_.swap(rhs.numaNode_);
+}
+
+void Thread::setNumaNode(usize node) noexcept {
+	numaNode_ = node;
+}
+
+Option<usize> Thread::numaNode() const noexcept {
+	return numaNode_;
 }
 
 void Thread::sleepUntil(time::Instant instant) noexcept {
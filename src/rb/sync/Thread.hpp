@@ -2,6 +2,7 @@
 
 #include <rb/core/export.hpp>
 #include <rb/core/memory/UniquePtr.hpp>
+#include <rb/core/Option.hpp>
 #include <rb/time/Instant.hpp>
 
 namespace rb::sync {
@@ -67,10 +68,18 @@ public:
 	void join();
 	void start();
 
+	/// Makes the thread bind itself to NUMA @p node before run() (see core::bindThreadToNumaNode()),
+	/// so memory it first touches, as well as `core::NumaAllocator(node)` blocks, are local to its CPUs.
+	/// Takes effect on the next start(); ignored on single-node machines.
+	void setNumaNode(usize node) noexcept;
+
+	core::Option<usize> numaNode() const noexcept;
+
 private:
 	struct Impl;
 
 	core::UniquePtr<Impl> pImpl_;
+	core::Option<usize> numaNode_;
 };
 
 RB_WARNING_POP
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <cstring>
 
 #include <rb/core/Expected.hpp>
 #include <rb/core/int128.hpp>
+#include <rb/core/NicheTraits.hpp>
 #include <rb/core/quorem.hpp>
 #include <rb/core/requires.hpp>
 #include <rb/core/traits/enums.hpp>
@@ -144,6 +146,7 @@ public:
 private:
 	friend std::ostream& operator<<(std::ostream& os, Duration dur);
 	friend constexpr Duration impl::duration(i64 seconds, i64 ticks) noexcept;
+	friend struct core::NicheTraits<Duration>;
 
 	static constexpr u32 kInfTicks = ~0U;
 	static constexpr u32 kNaNTicks = kTicksPerSecond;
@@ -157,6 +160,10 @@ private:
 
 	constexpr core::i128 toTicks() const noexcept;
 
+	/// @return `toTicks() / kTicksPerUnit` without a 128-bit division
+	template <u32 kTicksPerUnit>
+	constexpr core::i128 toUnits() const noexcept;
+
 	impl::I64 seconds_;
 	u32 ticks_ = 0;
 };
@@ -327,6 +334,15 @@ constexpr core::i128 Duration::toTicks() const noexcept {
 	return ticks * kTicksPerSecond + ticks_;
 }
 
+template <u32 kTicksPerUnit>
+constexpr core::i128 Duration::toUnits() const noexcept {
+	static_assert(kTicksPerSecond % kTicksPerUnit == 0);
+	// the subsecond ticks are non-negative, so the quotient is floored and must be rounded towards zero
+	auto const seconds = static_cast<i64>(seconds_);
+	bool const inexact = seconds < 0 && ticks_ % kTicksPerUnit != 0;
+	return core::i128{seconds} * (kTicksPerSecond / kTicksPerUnit) + ticks_ / kTicksPerUnit + inexact;
+}
+
 constexpr Duration::operator bool() const noexcept {
 	return seconds_ || ticks_;
 }
@@ -764,7 +780,7 @@ constexpr core::i128 Duration::toNanoseconds() const noexcept {
 		return isNegative() ? core::i128::min() : core::i128::max();
 	}
 
-	return toTicks() / kTicksPerNanosecond;
+	return toUnits<kTicksPerNanosecond>();
 }
 
 constexpr core::i128 Duration::toMicroseconds() const noexcept {
@@ -776,7 +792,7 @@ constexpr core::i128 Duration::toMicroseconds() const noexcept {
 		return isNegative() ? core::i128::min() : core::i128::max();
 	}
 
-	return toTicks() / (kTicksPerNanosecond * 1000);
+	return toUnits<kTicksPerNanosecond * 1000>();
 }
 
 constexpr core::i128 Duration::toMilliseconds() const noexcept {
@@ -788,7 +804,7 @@ constexpr core::i128 Duration::toMilliseconds() const noexcept {
 		return isNegative() ? core::i128::min() : core::i128::max();
 	}
 
-	return toTicks() / (kTicksPerNanosecond * 1000 * 1000);
+	return toUnits<kTicksPerNanosecond * 1000 * 1000>();
 }
 
 constexpr i64 Duration::toSeconds() const noexcept {
@@ -945,5 +961,34 @@ constexpr core::Option<TimeSpec> Duration::toTimeSpec() const noexcept {
 
 } // namespace rb::time
 
+/// Ticks between NaN and infinity are never held by Duration, so `Option<Duration>` is as large as Duration.
+template <>
+struct rb::core::NicheTraits<rb::time::Duration> {
+	using Duration = time::Duration;
+
+	static constexpr usize kCount = Duration::kInfTicks - Duration::kNaNTicks - 1;
+
+	static constexpr Duration make(usize niche) noexcept {
+		return Duration(0, static_cast<u32>(Duration::kNaNTicks + 1 + niche));
+	}
+
+	static constexpr usize index(Duration dur) noexcept {
+		return dur.ticks_ > Duration::kNaNTicks && dur.ticks_ < Duration::kInfTicks
+		         ? dur.ticks_ - Duration::kNaNTicks - 1
+		         : kCount;
+	}
+
+	static void store(void* storage, usize niche) noexcept {
+		Duration const dur = make(niche);
+		std::memcpy(storage, &dur, sizeof(Duration));
+	}
+
+	static usize load(void const* storage) noexcept {
+		Duration dur;
+		std::memcpy(&dur, storage, sizeof(Duration));
+		return index(dur);
+	}
+};
+
 #undef RB_REQUIRES_FLOAT
 #undef RB_REQUIRES_INTEGRAL